@@ -0,0 +1,81 @@
+#include "Misc/AutomationTest.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "VoxelTestUtils.h"
+#include "VoxelEditJournal.h"
+#include "VoxelSaveSystem.h"
+#include "VoxelGenerator.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelJournalReplayTest, "VoxelCore.EditJournal.CrashReplay",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelJournalReplayTest::RunTest(const FString& Parameters)
+{
+    constexpr int32 TestSeed = 0x7E57043;
+    const FString WorldDir = VoxelSaveSystem::GetWorldDir(TestSeed);
+    IFileManager::Get().DeleteDirectory(*WorldDir, false, true);
+
+    const FChunkKey A(0, 0), B(1, 0);
+    const int32 First = IndexFromXYZ(2, 120, 3); // high up, so the generated base is air
+    const uint8 Air = (uint8)EBlockId::Air, Glass = (uint8)EBlockId::Glass, Lamp = (uint8)EBlockId::Lamp;
+
+    // Two transactions, the second overwriting part of the first; the writer flushes on destruction
+    {
+        FVoxelEditJournal Journal(TestSeed);
+        const FVoxelEditRecord Fill[] =
+        {
+            { A, First, Air, Glass }, { A, First + 1, Air, Glass }, { A, First + 2, Air, Glass }, { A, First + 3, Air, Glass },
+            { B, First, Air, Glass },
+        };
+        Journal.Append(Fill, 1);
+        const FVoxelEditRecord Overwrite[] = { { A, First + 1, Glass, Lamp } };
+        Journal.Append(Overwrite, 2);
+    }
+
+    // The process dies halfway through the next record
+    const FString JournalFile = FPaths::Combine(WorldDir, TEXT("Edits.vcj"));
+    TArray<uint8> Bytes;
+    TestTrue(TEXT("Journal written"), FFileHelper::LoadFileToArray(Bytes, *JournalFile));
+    Bytes.AddZeroed(11);
+    FFileHelper::SaveArrayToFile(Bytes, *JournalFile);
+
+    TArray<FVoxelJournalEntry> Entries;
+    TestTrue(TEXT("Journal loads"), FVoxelEditJournal::Load(TestSeed, Entries));
+    TestEqual(TEXT("Torn tail dropped, runs expanded"), Entries.Num(), 6);
+    if (Entries.Num() == 6)
+    {
+        TestEqual(TEXT("Run order kept"), Entries[2].Edit.Index, First + 2);
+        TestTrue(TEXT("Second chunk kept"), Entries[4].Edit.Key == B);
+        TestEqual(TEXT("Transaction ids kept"), (int32)Entries[5].Transaction, 2);
+    }
+
+    // Replay onto saves the way BeginPlay does after a crash
+    AVoxelWorldManager* Manager = FVoxelWorldManagerTestAccess::NewManager();
+    Manager->WorldSeed = TestSeed;
+    FVoxelWorldManagerTestAccess::RecoverJournal(*Manager);
+
+    const FVoxelGeneratorConfig Config = Manager->GetGeneratorConfig();
+    auto LoadSaved = [&Config](const FChunkKey& Key, FVoxelChunkData& Data)
+        {
+            return VoxelSaveSystem::LoadChunk(Config, Data, [&Config, &Key](FVoxelChunkData& Base)
+                {
+                    FVoxelGenerator Gen(Config);
+                    Gen.GenerateChunk(Key, Base);
+                });
+        };
+
+    FVoxelChunkData DataA(A), DataB(B);
+    TestTrue(TEXT("Chunk A saved by replay"), LoadSaved(A, DataA));
+    TestTrue(TEXT("Chunk B saved by replay"), LoadSaved(B, DataB));
+    TestEqual(TEXT("A[0]"), (int32)DataA.GetRawAtIndex(First), (int32)Glass);
+    TestEqual(TEXT("A[1]: later transaction wins"), (int32)DataA.GetRawAtIndex(First + 1), (int32)Lamp);
+    TestEqual(TEXT("A[3]"), (int32)DataA.GetRawAtIndex(First + 3), (int32)Glass);
+    TestEqual(TEXT("B[0]"), (int32)DataB.GetRawAtIndex(First), (int32)Glass);
+
+    IFileManager::Get().DeleteDirectory(*WorldDir, false, true);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,80 @@
+#include "Misc/AutomationTest.h"
+#include "VoxelFluid.h"
+#include "ChunkConfig.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    // One chunk's ids, stone below Y = 5 and air above, as the game thread would snapshot it
+    TArray<uint8> MakeFloorIds()
+    {
+        TArray<uint8> Ids;
+        Ids.SetNumZeroed(CHUNK_VOLUME);
+        FMemory::Memset(Ids.GetData(), (uint8)EBlockId::Stone, CHUNK_SIZE_X * CHUNK_SIZE_Z * 5);
+        return Ids;
+    }
+
+    uint8& At(VoxelFluid::FStep& Step, const FIntVector& G)
+    {
+        return Step.Chunks.FindChecked(FChunkKey(0, 0))[IndexFromXYZ(G.X, G.Y, G.Z)];
+    }
+
+    // Runs one step over Cells and applies its writes to the snapshot, as ApplyFluidStep would
+    void RunStep(VoxelFluid::FStep& Step, TArray<FIntVector> Cells)
+    {
+        Step.Cells = MoveTemp(Cells);
+        VoxelFluid::Run(Step);
+        for (const VoxelFluid::FWrite& W : Step.Writes)
+        {
+            At(Step, W.Cell) = W.NewId;
+        }
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelFluidStepTest, "VoxelCore.Fluid.SpreadAndDrain",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelFluidStepTest::RunTest(const FString& Parameters)
+{
+    using namespace VoxelFluid;
+
+    VoxelFluid::FStep Step;
+    Step.Chunks.Add(FChunkKey(0, 0), MakeFloorIds());
+
+    const FIntVector Source(8, 5, 8), Next(9, 5, 8), Edge(10, 5, 8), Hole(10, 4, 8), Past(11, 5, 8);
+    At(Step, Source) = (uint8)EBlockId::Water;
+    At(Step, Hole) = (uint8)EBlockId::Air;
+
+    // Spread: one level weaker per cell along the floor
+    RunStep(Step, { Next });
+    TestEqual(TEXT("Next to the source"), (int32)LevelOf(At(Step, Next)), 7);
+    TestEqual(TEXT("One write"), Step.Writes.Num(), 1);
+    if (Step.Writes.Num() == 1)
+    {
+        TestEqual(TEXT("Write records the id it read"), (int32)Step.Writes[0].OldId, (int32)EBlockId::Air);
+    }
+
+    RunStep(Step, { Edge, Hole });
+    TestEqual(TEXT("Second cell"), (int32)LevelOf(At(Step, Edge)), 6);
+    TestEqual(TEXT("Hole under air stays dry this step"), (int32)At(Step, Hole), (int32)EBlockId::Air);
+
+    // Fall: the hole under flowing water fills as falling water, and water over the drop does not spread on
+    RunStep(Step, { Hole, Past });
+    TestEqual(TEXT("Falling water"), (int32)LevelOf(At(Step, Hole)), (int32)SourceLevel - 1);
+    TestEqual(TEXT("No spread over the drop"), (int32)At(Step, Past), (int32)EBlockId::Air);
+
+    // Sources never change, and a stable cell writes nothing
+    RunStep(Step, { Source, Next });
+    TestEqual(TEXT("Source unchanged"), (int32)At(Step, Source), (int32)EBlockId::Water);
+    TestEqual(TEXT("Settled cells write nothing"), Step.Writes.Num(), 0);
+
+    // Drain: without the source the flow it fed goes back to air
+    At(Step, Source) = (uint8)EBlockId::Air;
+    RunStep(Step, { Next });
+    TestEqual(TEXT("Drained next to the removed source"), (int32)At(Step, Next), (int32)EBlockId::Air);
+
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
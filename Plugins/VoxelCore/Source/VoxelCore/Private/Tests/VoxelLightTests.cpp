@@ -0,0 +1,88 @@
+#include "Misc/AutomationTest.h"
+#include "VoxelLight.h"
+#include "VoxelChunk.h"
+#include "VoxelMesher.h"          // FVoxelChunkNeighbors
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    // Solid stone (no sky light) with a one-block tunnel along X at Y = 10, Z = 5
+    TSharedPtr<FVoxelChunkData> MakeTunnelChunk(const FChunkKey& Key)
+    {
+        TSharedPtr<FVoxelChunkData> Data = MakeShared<FVoxelChunkData>(Key);
+        FMemory::Memset(Data->Blocks.GetData(), (uint8)EBlockId::Stone, CHUNK_VOLUME);
+        for (int32 X = 0; X < CHUNK_SIZE_X; ++X)
+        {
+            Data->Blocks[IndexFromXYZ(X, 10, 5)] = (uint8)EBlockId::Air;
+        }
+        return Data;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelLightBorderTest, "VoxelCore.Light.AcrossChunkBorder",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelLightBorderTest::RunTest(const FString& Parameters)
+{
+    const FChunkKey KeyA(0, 0), KeyB(1, 0);
+    TMap<FChunkKey, TSharedPtr<FVoxelChunkData>> Chunks;
+    auto Resolve = [&Chunks](const FChunkKey& K) -> FVoxelChunkData*
+        {
+            const TSharedPtr<FVoxelChunkData>* Found = Chunks.Find(K);
+            return Found ? Found->Get() : nullptr;
+        };
+    auto BlockAt = [&Resolve](int32 GX) -> int32
+        {
+            int32 LX = 0, LZ = 0;
+            const FChunkKey Key = GlobalToChunkLocal(GX, 5, LX, LZ);
+            return VoxelLight::Block(Resolve(Key)->Light[IndexFromXYZ(LX, 10, LZ)]);
+        };
+    const FIntVector LampCell(14, 10, 5);
+
+    // A lamp two cells from the border lights the neighbour once the borders are stitched
+    Chunks.Add(KeyA, MakeTunnelChunk(KeyA));
+    Chunks.Add(KeyB, MakeTunnelChunk(KeyB));
+    Chunks[KeyA]->Blocks[IndexFromXYZ(14, 10, 5)] = (uint8)EBlockId::Lamp;
+    VoxelLight::ComputeChunk(*Chunks[KeyA], nullptr);
+    VoxelLight::ComputeChunk(*Chunks[KeyB], nullptr);
+    TestEqual(TEXT("Lamp cell"), BlockAt(14), 15);
+    TestEqual(TEXT("Confined before stitching"), BlockAt(16), 0);
+
+    VoxelLight::FChanges Changes;
+    VoxelLight::StitchBorders(KeyA, Resolve, Changes);
+    TestEqual(TEXT("First cell across the border"), BlockAt(16), 13);
+    TestEqual(TEXT("Further into the neighbour"), BlockAt(20), 9);
+    TestTrue(TEXT("Neighbour reported for remesh"), Changes.Contains(KeyB));
+
+    // Removing the lamp takes its light back out of both chunks
+    Changes.Reset();
+    Chunks[KeyA]->SetBlockAt(14, 10, 5, EBlockId::Air);
+    VoxelLight::UpdateAfterEdits(MakeArrayView(&LampCell, 1), Resolve, Changes);
+    TestEqual(TEXT("Lamp cell after removal"), BlockAt(14), 0);
+    TestEqual(TEXT("Neighbour after removal"), BlockAt(16), 0);
+    TestEqual(TEXT("Far end after removal"), BlockAt(20), 0);
+    TestTrue(TEXT("Neighbour reported after removal"), Changes.Contains(KeyB));
+
+    // Light B got from A outlives A's lamp when A comes back without it (edited while unloaded);
+    // A's fill even pulls it back in. Stitching has to clear it from both sides.
+    Chunks[KeyA]->SetBlockAt(14, 10, 5, EBlockId::Lamp);
+    VoxelLight::ComputeChunk(*Chunks[KeyA], nullptr);
+    VoxelLight::StitchBorders(KeyA, Resolve, Changes);
+    TestEqual(TEXT("Relit across the border"), BlockAt(16), 13);
+
+    Chunks[KeyA] = MakeTunnelChunk(KeyA);
+    FVoxelChunkNeighbors Neighbors;
+    Neighbors.CopyFrom(1, 0, *Chunks[KeyB]);
+    VoxelLight::ComputeChunk(*Chunks[KeyA], &Neighbors);
+    TestEqual(TEXT("Reloaded chunk pulled in stale light"), BlockAt(15), 12);
+
+    Changes.Reset();
+    VoxelLight::StitchBorders(KeyA, Resolve, Changes);
+    TestEqual(TEXT("Stale light cleared on the reloaded side"), BlockAt(15), 0);
+    TestEqual(TEXT("Stale light cleared at the border"), BlockAt(16), 0);
+    TestEqual(TEXT("Stale light cleared further in"), BlockAt(20), 0);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
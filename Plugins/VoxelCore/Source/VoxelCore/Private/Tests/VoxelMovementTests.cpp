@@ -0,0 +1,97 @@
+#include "Misc/AutomationTest.h"
+#include "VoxelTestUtils.h"
+#include "VoxelMovementComponent.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    // 3x3 chunks around the origin (unloaded chunks collide as solid) with a stone floor up to Y = 4
+    AVoxelWorldManager* MakeFloorWorld()
+    {
+        AVoxelWorldManager* Manager = FVoxelWorldManagerTestAccess::NewManager();
+        for (int32 CZ = -1; CZ <= 1; ++CZ)
+        {
+            for (int32 CX = -1; CX <= 1; ++CX)
+            {
+                FVoxelChunkData& Data = FVoxelWorldManagerTestAccess::AddChunk(*Manager, FChunkKey(CX, CZ));
+                for (int32 I = 0; I < CHUNK_SIZE_X * CHUNK_SIZE_Z * 5; ++I)
+                {
+                    Data.Blocks[I] = (uint8)EBlockId::Stone;
+                }
+            }
+        }
+        return Manager;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelBoxSweepTest, "VoxelCore.Movement.BoxSweep",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelBoxSweepTest::RunTest(const FString& Parameters)
+{
+    AVoxelWorldManager* Manager = MakeFloorWorld();
+    FVoxelWorldManagerTestAccess::SetVoxel(*Manager, FIntVector(3, 5, 0), EBlockId::Stone);
+
+    // Floor top face is at Z = 4.5 blocks; a box resting there touches it without overlapping
+    const FVector Extent(30.f, 30.f, 80.f);
+    const FBox Standing = FBox(FVector(100.f, 0.f, 530.f) - Extent, FVector(100.f, 0.f, 530.f) + Extent);
+    TestFalse(TEXT("Resting contact is not an overlap"), Manager->OverlapVoxelBox(Standing));
+
+    FVoxelSweepHit Hit;
+    const FBox High = Standing.ShiftBy(FVector(0.f, 0.f, 470.f));
+    TestTrue(TEXT("Falling box lands"), Manager->SweepVoxelBox(High, FVector(0.f, 0.f, -1000.f), Hit));
+    TestEqual(TEXT("Lands on the floor face"), Hit.Time, 0.47f, 1e-4f);
+    TestTrue(TEXT("Floor normal"), Hit.Normal.Equals(FVector(0.f, 0.f, 1.f)));
+    TestEqual(TEXT("Contact height"), Hit.Location.Z, 530.0, 1e-2);
+
+    TestTrue(TEXT("Walking into the ledge blocks"), Manager->SweepVoxelBox(Standing, FVector(300.f, 0.f, 0.f), Hit));
+    TestEqual(TEXT("Stops at the ledge face"), Hit.Time, 0.4f, 1e-4f);
+    TestTrue(TEXT("Ledge normal"), Hit.Normal.Equals(FVector(-1.f, 0.f, 0.f)));
+    TestTrue(TEXT("Ledge voxel"), Hit.Voxel == FIntVector(3, 5, 0));
+
+    TestFalse(TEXT("Walking away from the ledge is clear"), Manager->SweepVoxelBox(Standing, FVector(-300.f, 0.f, 0.f), Hit));
+
+    TestTrue(TEXT("Box inside the floor starts penetrating"), Manager->SweepVoxelBox(Standing.ShiftBy(FVector(0.f, 0.f, -100.f)), FVector(50.f, 0.f, 0.f), Hit));
+    TestTrue(TEXT("Start penetrating flag"), Hit.bStartPenetrating);
+    return true;
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelStepUpTest, "VoxelCore.Movement.StepUp",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelStepUpTest::RunTest(const FString& Parameters)
+{
+    const FVector Extent(30.f, 30.f, 80.f);
+    const FBox Standing = FBox(FVector(100.f, 0.f, 530.f) - Extent, FVector(100.f, 0.f, 530.f) + Extent);
+    const FVector Move(250.f, 0.f, 0.f); // ends past the ledge's near edge
+
+    {
+        AVoxelWorldManager* Manager = MakeFloorWorld();
+        FVoxelWorldManagerTestAccess::SetVoxel(*Manager, FIntVector(3, 5, 0), EBlockId::Stone);
+        TestTrue(TEXT("Climbs a one-block ledge"), UVoxelMovementComponent::CanStepUp(*Manager, Standing, Move, Manager->BlockSize));
+    }
+    {
+        AVoxelWorldManager* Manager = MakeFloorWorld();
+        FVoxelWorldManagerTestAccess::SetVoxel(*Manager, FIntVector(3, 5, 0), EBlockId::Stone);
+        FVoxelWorldManagerTestAccess::SetVoxel(*Manager, FIntVector(3, 6, 0), EBlockId::Stone);
+        TestFalse(TEXT("Does not climb a two-block wall"), UVoxelMovementComponent::CanStepUp(*Manager, Standing, Move, Manager->BlockSize));
+    }
+    {
+        // Free on top of the ledge, but the ceiling over the pawn's head leaves no room to rise
+        AVoxelWorldManager* Manager = MakeFloorWorld();
+        FVoxelWorldManagerTestAccess::SetVoxel(*Manager, FIntVector(3, 5, 0), EBlockId::Stone);
+        FVoxelWorldManagerTestAccess::SetVoxel(*Manager, FIntVector(1, 7, 0), EBlockId::Stone);
+        TestFalse(TEXT("Needs head clearance where it stands"), UVoxelMovementComponent::CanStepUp(*Manager, Standing, Move, Manager->BlockSize));
+    }
+    {
+        // The landing spot is free, but a block between it and the start is in the way
+        AVoxelWorldManager* Manager = MakeFloorWorld();
+        FVoxelWorldManagerTestAccess::SetVoxel(*Manager, FIntVector(3, 5, 0), EBlockId::Stone);
+        FVoxelWorldManagerTestAccess::SetVoxel(*Manager, FIntVector(2, 7, 0), EBlockId::Stone);
+        TestFalse(TEXT("Needs a clear path across"), UVoxelMovementComponent::CanStepUp(*Manager, Standing, Move, Manager->BlockSize));
+    }
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
@@ -0,0 +1,57 @@
+#include "Misc/AutomationTest.h"
+#include "VoxelTestUtils.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelRaycastTest, "VoxelCore.Queries.Raycast",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelRaycastTest::RunTest(const FString& Parameters)
+{
+    AVoxelWorldManager* Manager = FVoxelWorldManagerTestAccess::NewManager();
+    FVoxelWorldManagerTestAccess::AddChunk(*Manager, FChunkKey(0, 0));
+    FVoxelWorldManagerTestAccess::AddChunk(*Manager, FChunkKey(-1, 0));
+    FVoxelWorldManagerTestAccess::SetVoxel(*Manager, FIntVector(5, 10, 5), EBlockId::Stone);
+    FVoxelWorldManagerTestAccess::SetVoxel(*Manager, FIntVector(-3, 10, 5), EBlockId::Dirt);
+
+    // Voxel centers sit on the grid: voxel (X, Y up, Z) is centered at world (X, Z, Y) * BlockSize
+    const float BS = Manager->BlockSize;
+    auto WorldOf = [BS](double X, double Y, double Z) { return FVector(X, Z, Y) * BS; };
+
+    FVoxelRayHit Hit;
+    TestTrue(TEXT("Straight down hits"), Manager->RaycastVoxels(WorldOf(5, 20, 5), FVector(0, 0, -1), 50.f * BS, Hit));
+    TestTrue(TEXT("Straight down: voxel"), Hit.Global == FIntVector(5, 10, 5));
+    TestTrue(TEXT("Straight down: top face"), Hit.Normal == FIntVector(0, 1, 0));
+    TestEqual(TEXT("Straight down: distance to the top face"), Hit.Distance, 9.5 * BS, 1e-3);
+
+    TestTrue(TEXT("Along +X hits"), Manager->RaycastVoxels(WorldOf(0, 10, 5), FVector(1, 0, 0), 50.f * BS, Hit));
+    TestTrue(TEXT("Along +X: voxel"), Hit.Global == FIntVector(5, 10, 5));
+    TestTrue(TEXT("Along +X: -X face"), Hit.Normal == FIntVector(-1, 0, 0));
+    TestEqual(TEXT("Along +X: distance"), Hit.Distance, 4.5 * BS, 1e-3);
+
+    // Crossing into the neighbouring chunk reports the hit in that chunk's local coords
+    TestTrue(TEXT("Across the chunk border hits"), Manager->RaycastVoxels(WorldOf(2, 10, 5), FVector(-1, 0, 0), 50.f * BS, Hit));
+    TestTrue(TEXT("Across the border: chunk"), Hit.Key == FChunkKey(-1, 0));
+    TestEqual(TEXT("Across the border: local X"), Hit.X, CHUNK_SIZE_X - 3);
+    TestTrue(TEXT("Across the border: +X face"), Hit.Normal == FIntVector(1, 0, 0));
+    TestTrue(TEXT("Adjacent cell is on the ray side"), [&Hit]()
+        {
+            FChunkKey K; int32 X, Y, Z;
+            return Hit.GetAdjacent(K, X, Y, Z) && K == FChunkKey(-1, 0) && X == CHUNK_SIZE_X - 2 && Y == 10;
+        }());
+
+    // Diagonal through the corner region still lands on the block, entering through one face
+    TestTrue(TEXT("Diagonal hits"), Manager->RaycastVoxels(WorldOf(1, 14, 5), FVector(1, 0, -1), 50.f * BS, Hit));
+    TestTrue(TEXT("Diagonal: voxel"), Hit.Global == FIntVector(5, 10, 5));
+    TestTrue(TEXT("Diagonal: one face"), Hit.Normal.Size() == 1);
+
+    FVoxelRayHit Miss;
+    TestFalse(TEXT("Ray into the sky misses"), Manager->RaycastVoxels(WorldOf(5, 20, 5), FVector(0, 0, 1), 500.f * BS, Miss));
+    TestFalse(TEXT("Ray stops at MaxDistance"), Manager->RaycastVoxels(WorldOf(5, 20, 5), FVector(0, 0, -1), 9.f * BS, Miss));
+
+    TestTrue(TEXT("Ray starting inside a block hits it"), Manager->RaycastVoxels(WorldOf(5, 10, 5), FVector(1, 0, 0), BS, Hit));
+    TestTrue(TEXT("Starting inside: no face"), Hit.Normal == FIntVector::ZeroValue);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
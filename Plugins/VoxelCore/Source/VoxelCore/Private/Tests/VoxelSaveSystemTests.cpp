@@ -0,0 +1,98 @@
+#include "Misc/AutomationTest.h"
+#include "HAL/FileManager.h"
+#include "VoxelSaveSystem.h"
+#include "VoxelChunk.h"
+#include "VoxelGenerator.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace
+{
+    constexpr int32 TestSeed = 0x7E57027;
+
+    // Deterministic stand-in for the generator: stone below 40, dirt to 44, air above
+    void FillTestBase(FVoxelChunkData& Data)
+    {
+        Data.Blocks.SetNumUninitialized(CHUNK_VOLUME);
+        for (int32 I = 0; I < CHUNK_VOLUME; ++I)
+        {
+            int32 X, Y, Z;
+            XYZFromIndex(I, X, Y, Z);
+            Data.Blocks[I] = (uint8)(Y < 40 ? EBlockId::Stone : (Y < 44 ? EBlockId::Dirt : EBlockId::Air));
+        }
+    }
+
+    bool SameContents(const FVoxelChunkData& A, const FVoxelChunkData& B)
+    {
+        TArray<uint8> DA, DB;
+        A.GetFlattened(DA);
+        B.GetFlattened(DB);
+        return DA == DB;
+    }
+}
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FVoxelSaveRoundTripTest, "VoxelCore.SaveSystem.RoundTrip",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FVoxelSaveRoundTripTest::RunTest(const FString& Parameters)
+{
+    FVoxelGeneratorConfig Config;
+    Config.Seed = TestSeed;
+    IFileManager::Get().DeleteDirectory(*VoxelSaveSystem::GetWorldDir(TestSeed), false, true);
+
+    // A few edits stay a delta save on top of the base
+    {
+        FVoxelChunkData Saved(FChunkKey(2, -3));
+        FillTestBase(Saved);
+        Saved.SetBlockAt(1, 44, 1, EBlockId::Glass);
+        Saved.SetBlockAt(15, 0, 15, EBlockId::Air);
+        Saved.SetBlockAt(7, 127, 3, EBlockId::Lamp);
+        VoxelSaveSystem::SaveDelta(Config, Saved);
+
+        FVoxelChunkData Loaded(Saved.Key);
+        TestTrue(TEXT("Delta save loads"), VoxelSaveSystem::LoadChunk(Config, Loaded, [](FVoxelChunkData& D) { FillTestBase(D); }));
+        TestFalse(TEXT("Delta save keeps the generated base"), Loaded.bSnapshotBase);
+        TestEqual(TEXT("Delta count"), Loaded.ModifiedBlocks.Num(), 3);
+        TestTrue(TEXT("Delta contents survive"), SameContents(Saved, Loaded));
+    }
+
+    // A snapshot chunk with many ids goes through the palettized encoding and skips generation
+    {
+        FVoxelChunkData Saved(FChunkKey(-1, 4));
+        FillTestBase(Saved);
+        for (int32 I = 0; I < CHUNK_VOLUME; I += 7)
+        {
+            Saved.Blocks[I] = (uint8)(I % (int32)EBlockId::Max);
+        }
+        Saved.bSnapshotBase = true;
+        VoxelSaveSystem::SaveDelta(Config, Saved);
+
+        bool bGenerated = false;
+        FVoxelChunkData Loaded(Saved.Key);
+        TestTrue(TEXT("Snapshot save loads"), VoxelSaveSystem::LoadChunk(Config, Loaded, [&bGenerated](FVoxelChunkData& D) { bGenerated = true; FillTestBase(D); }));
+        TestFalse(TEXT("Snapshot load does not generate a base"), bGenerated);
+        TestTrue(TEXT("Snapshot load marks the base as saved"), Loaded.bSnapshotBase);
+        TestTrue(TEXT("Palettized contents survive"), SameContents(Saved, Loaded));
+    }
+
+    // Sidecar edits merge over the save and are folded in (and the .vce dropped) by the next save
+    {
+        const FChunkKey Key(5, 5);
+        const TPair<int32, uint8> Edits[] = { { IndexFromXYZ(0, 50, 0), (uint8)EBlockId::Log }, { IndexFromXYZ(1, 50, 0), (uint8)EBlockId::Log } };
+        VoxelSaveSystem::AppendEdits(TestSeed, Key, Edits);
+        TestFalse(TEXT("A sidecar alone is not a save"), VoxelSaveSystem::HasChunk(TestSeed, Key));
+
+        FVoxelChunkData Loaded(Key);
+        TestTrue(TEXT("Sidecar merges"), VoxelSaveSystem::LoadChunk(Config, Loaded, [](FVoxelChunkData& D) { FillTestBase(D); }));
+        TestTrue(TEXT("Sidecar edit applied"), Loaded.GetBlockAt(1, 50, 0) == EBlockId::Log);
+
+        VoxelSaveSystem::SaveDelta(Config, Loaded);
+        TestTrue(TEXT("Saved after merge"), VoxelSaveSystem::HasChunk(TestSeed, Key));
+        TestFalse(TEXT("Sidecar deleted"), IFileManager::Get().FileExists(*FPaths::Combine(VoxelSaveSystem::GetWorldDir(TestSeed), TEXT("Chunks"), TEXT("5_5.vce"))));
+    }
+
+    IFileManager::Get().DeleteDirectory(*VoxelSaveSystem::GetWorldDir(TestSeed), false, true);
+    return true;
+}
+
+#endif // WITH_DEV_AUTOMATION_TESTS
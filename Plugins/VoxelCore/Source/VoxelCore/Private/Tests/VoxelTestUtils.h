@@ -0,0 +1,41 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Package.h"
+#include "VoxelWorldManager.h"
+#include "VoxelChunk.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Reaches into AVoxelWorldManager for tests: no world and no streaming, only the chunks a test adds. */
+struct FVoxelWorldManagerTestAccess
+{
+    // Manager outside any world; BeginPlay never runs, so nothing streams or meshes
+    static AVoxelWorldManager* NewManager()
+    {
+        return NewObject<AVoxelWorldManager>(GetTransientPackage());
+    }
+
+    // Registers an all-air chunk as loaded
+    static FVoxelChunkData& AddChunk(AVoxelWorldManager& Manager, const FChunkKey& Key)
+    {
+        FChunkRecord& Rec = Manager.Loaded.FindOrAdd(Key);
+        Rec.Data = MakeShared<FVoxelChunkData>(Key);
+        return *Rec.Data;
+    }
+
+    // Writes the base block at global voxel coords (X, Y up, Z); the chunk must have been added
+    static void SetVoxel(AVoxelWorldManager& Manager, const FIntVector& G, EBlockId Id)
+    {
+        int32 LX = 0, LZ = 0;
+        const FChunkKey Key = GlobalToChunkLocal(G.X, G.Z, LX, LZ);
+        Manager.Loaded.FindChecked(Key).Data->SetBlockAt(LX, G.Y, LZ, Id, /*bMarkModified=*/false);
+    }
+
+    static void RecoverJournal(AVoxelWorldManager& Manager)
+    {
+        Manager.RecoverJournal();
+    }
+};
+
+#endif // WITH_DEV_AUTOMATION_TESTS
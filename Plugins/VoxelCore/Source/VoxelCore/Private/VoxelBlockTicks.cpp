@@ -0,0 +1,166 @@
+#include "VoxelBlockTicks.h"
+#include "VoxelChunk.h"
+#include "VoxelBlockRegistry.h"
+#include "VoxelLight.h"
+#include "ChunkConfig.h"
+#include "Math/RandomStream.h"
+
+namespace
+{
+    constexpr int32 SectionVolume = CHUNK_SIZE_X * CHUNK_SIZE_Z * CHUNK_SECTION_HEIGHT;
+
+    // Light grass needs on top to spread onto dirt
+    constexpr uint8 MinGrassLight = 9;
+
+    const FIntVector Up(0, 1, 0);
+
+    // Voxel reads by global coords for a job (one-chunk cache, starting at the job's chunk)
+    struct FTickView
+    {
+        VoxelBlockTicks::FLookup Lookup;
+        FChunkKey CachedKey;
+        const FVoxelChunkData* Cached = nullptr;
+
+        FTickView(VoxelBlockTicks::FLookup InLookup, const FChunkKey& Key, const FVoxelChunkData* Data)
+            : Lookup(InLookup), CachedKey(Key), Cached(Data) {}
+
+        const FVoxelChunkData* Find(const FIntVector& G, int32& OutIndex)
+        {
+            if (G.Y < 0 || G.Y >= CHUNK_SIZE_Y) return nullptr;
+
+            int32 LX = 0, LZ = 0;
+            const FChunkKey Key = GlobalToChunkLocal(G.X, G.Z, LX, LZ);
+            if (!(Key == CachedKey))
+            {
+                CachedKey = Key;
+                Cached = Lookup(Key);
+            }
+            OutIndex = IndexFromXYZ(LX, G.Y, LZ);
+            return Cached;
+        }
+
+        // Unloaded cells read as stone so nothing reacts across a missing chunk
+        uint8 Get(const FIntVector& G)
+        {
+            int32 I = 0;
+            const FVoxelChunkData* C = Find(G, I);
+            if (!C) return G.Y >= CHUNK_SIZE_Y ? (uint8)EBlockId::Air : (uint8)EBlockId::Stone;
+            return C->GetRawAtIndex(I);
+        }
+
+        // Unlit chunks count as daylight, like the mesher
+        uint8 LightAt(const FIntVector& G)
+        {
+            int32 I = 0;
+            const FVoxelChunkData* C = Find(G, I);
+            if (!C || C->Light.Num() != CHUNK_VOLUME) return VoxelLight::MaxLevel;
+            return VoxelLight::Level(C->Light[I]);
+        }
+    };
+
+    // Grass dies under anything opaque or wet
+    bool CoversGrass(uint8 Id)
+    {
+        const FVoxelBlockDef& Def = VoxelBlocks::Get(Id);
+        return !Def.bTransparent || Def.FluidLevel != 0;
+    }
+
+    bool SmotherGrass(FTickView& V, const FIntVector& G, VoxelBlockTicks::FChunkJob& Job)
+    {
+        if (!CoversGrass(V.Get(G + Up))) return false;
+        Job.Writes.Add({ G, (uint8)EBlockId::Grass, (uint8)EBlockId::Dirt });
+        return true;
+    }
+
+    // Lit grass spreads to one random dirt block nearby (one sideways, three down to one up)
+    void SpreadGrass(FTickView& V, const FIntVector& G, FRandomStream& Rand, VoxelBlockTicks::FChunkJob& Job)
+    {
+        if (SmotherGrass(V, G, Job)) return;
+        if (V.LightAt(G + Up) < MinGrassLight) return;
+
+        const FIntVector T = G + FIntVector(Rand.RandRange(-1, 1), Rand.RandRange(-3, 1), Rand.RandRange(-1, 1));
+        if (V.Get(T) != (uint8)EBlockId::Dirt) return;
+        if (CoversGrass(V.Get(T + Up)) || V.LightAt(T + Up) < MinGrassLight) return;
+
+        Job.Writes.Add({ T, (uint8)EBlockId::Dirt, (uint8)EBlockId::Grass });
+    }
+
+    void ScheduledTick(FTickView& V, const FIntVector& G, uint8 Id, VoxelBlockTicks::FChunkJob& Job)
+    {
+        switch ((EBlockId)Id)
+        {
+        case EBlockId::Grass: SmotherGrass(V, G, Job); break;
+        default: break;
+        }
+    }
+
+    void RandomTick(FTickView& V, const FIntVector& G, uint8 Id, FRandomStream& Rand, VoxelBlockTicks::FChunkJob& Job)
+    {
+        switch ((EBlockId)Id)
+        {
+        case EBlockId::Grass: SpreadGrass(V, G, Rand, Job); break;
+        default: break;
+        }
+    }
+}
+
+namespace VoxelBlockTicks
+{
+    uint8 ScanRandomTickSections(const FVoxelChunkData& Data)
+    {
+        uint8 Mask = 0;
+        for (int32 S = 0; S < CHUNK_NUM_SECTIONS && Data.Blocks.Num() == CHUNK_VOLUME; ++S)
+        {
+            // Sections are contiguous index ranges (Y is the outermost axis)
+            const uint8* Src = Data.Blocks.GetData() + S * SectionVolume;
+            for (int32 I = 0; I < SectionVolume; ++I)
+            {
+                if (VoxelBlocks::Get(Src[I]).bRandomTick)
+                {
+                    Mask |= (uint8)(1u << S);
+                    break;
+                }
+            }
+        }
+        for (const TPair<int32, uint16>& P : Data.ModifiedBlocks)
+        {
+            if (VoxelBlocks::Get((uint8)P.Value).bRandomTick)
+            {
+                Mask |= (uint8)(1u << (P.Key / SectionVolume));
+            }
+        }
+        return Mask;
+    }
+
+    void RunChunk(FChunkJob& Job, FLookup Lookup)
+    {
+        if (!Job.Data) return;
+
+        FTickView V(Lookup, Job.Key, Job.Data);
+        FRandomStream Rand(Job.Seed);
+        const FIntVector Base(Job.Key.X * CHUNK_SIZE_X, 0, Job.Key.Z * CHUNK_SIZE_Z);
+
+        for (const int32 Index : Job.Scheduled)
+        {
+            FIntVector L;
+            XYZFromIndex(Index, L.X, L.Y, L.Z);
+            ScheduledTick(V, Base + L, Job.Data->GetRawAtIndex(Index), Job);
+        }
+
+        const uint8 Sections = Job.Data->RandomTickSections;
+        for (int32 S = 0; S < CHUNK_NUM_SECTIONS && Job.RandomPerSection > 0; ++S)
+        {
+            if ((Sections & (1u << S)) == 0) continue;
+            for (int32 K = 0; K < Job.RandomPerSection; ++K)
+            {
+                const int32 Index = S * SectionVolume + Rand.RandHelper(SectionVolume);
+                const uint8 Id = Job.Data->GetRawAtIndex(Index);
+                if (!VoxelBlocks::Get(Id).bRandomTick) continue;
+
+                FIntVector L;
+                XYZFromIndex(Index, L.X, L.Y, L.Z);
+                RandomTick(V, Base + L, Id, Rand, Job);
+            }
+        }
+    }
+}
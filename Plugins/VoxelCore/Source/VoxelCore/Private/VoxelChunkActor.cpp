@@ -5,50 +5,65 @@ AVoxelChunkActor::AVoxelChunkActor()
 {
     PrimaryActorTick.bCanEverTick = false;
 
-    ProcMesh = CreateDefaultSubobject<UProceduralMeshComponent>(TEXT("ProcMesh"));
-    SetRootComponent(ProcMesh);
+    ChunkMesh = CreateDefaultSubobject<UVoxelChunkMeshComponent>(TEXT("ChunkMesh"));
+    SetRootComponent(ChunkMesh);
 
-    ProcMesh->bUseAsyncCooking = true;
-    ProcMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-    ProcMesh->SetCollisionObjectType(ECC_WorldStatic);
-    ProcMesh->SetCollisionResponseToAllChannels(ECR_Block);
+    ChunkMesh->bUseAsyncCooking = true;
+    ChunkMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+    ChunkMesh->SetCollisionObjectType(ECC_WorldStatic);
+    ChunkMesh->SetCollisionResponseToAllChannels(ECR_Block);
 }
 
-void AVoxelChunkActor::BuildFromBuffers(const TArray<FVector>& Vertices,
-    const TArray<int32>& Triangles,
-    const TArray<FVector>& Normals,
-    const TArray<FVector2D>& UVs,
-    const TArray<FLinearColor>& Colors,
-    const TArray<FProcMeshTangent>& Tangents,
-    UMaterialInterface* UseMaterial)
+void AVoxelChunkActor::BuildFromBuffers(TArrayView<FVoxelMeshSectionBuffers> Buffers, UMaterialInterface* UseMaterial, bool bCollision)
 {
-    ProcMesh->ClearAllMeshSections();
-    ProcMesh->CreateMeshSection_LinearColor(0, Vertices, Triangles, Normals, UVs, Colors, Tangents, true);
+    ChunkMesh->SetNumMaterialSlots(1);
+    if (UseMaterial)
+    {
+        ChunkMesh->SetMaterial(0, UseMaterial);
+    }
+    for (int32 i = 0; i < Buffers.Num(); ++i)
+    {
+        ChunkMesh->SetSection(i, Buffers[i], bCollision);
+    }
+}
 
-    ProcMesh->bUseAsyncCooking = true;
-    ProcMesh->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
-    ProcMesh->SetCollisionObjectType(ECC_WorldStatic);
-    ProcMesh->SetCollisionResponseToAllChannels(ECR_Block);
+void AVoxelChunkActor::BuildFromSections(FVoxelMeshSectionBuffers (&Groups)[VOXEL_NUM_MESH_GROUPS], uint8 SectionMask,
+    UMaterialInterface* const (&Materials)[VOXEL_NUM_RENDER_LAYERS], bool bCollision, uint8 LayerMask)
+{
+    ChunkMesh->SetNumMaterialSlots(VOXEL_NUM_RENDER_LAYERS);
+    for (int32 L = 0; L < VOXEL_NUM_RENDER_LAYERS; ++L)
+    {
+        if (Materials[L])
+        {
+            ChunkMesh->SetMaterial(L, Materials[L]);
+        }
+    }
 
-    if (UseMaterial)
+    uint32 UpdateMask = 0;
+    uint32 CollisionMask = 0;
+    for (int32 S = 0; S < CHUNK_NUM_SECTIONS; ++S)
     {
-        ProcMesh->SetMaterial(0, UseMaterial);
+        if ((SectionMask & (1u << S)) == 0) continue;
+        for (int32 L = 0; L < VOXEL_NUM_RENDER_LAYERS; ++L)
+        {
+            if ((LayerMask & (1u << L)) == 0) continue;
+            const uint32 Bit = 1u << VoxelMeshGroup(S, L);
+            UpdateMask |= Bit;
+            if (bCollision && L != (int32)EVoxelRenderLayer::Translucent) CollisionMask |= Bit;
+        }
     }
+    ChunkMesh->SetSections(MakeArrayView(Groups), UpdateMask, CollisionMask);
 }
 
 void AVoxelChunkActor::BuildFromChunk(const FVoxelChunkData& Chunk, float InBlockSize, UMaterialInterface* UseMaterial)
 {
     BlockSize = InBlockSize;
 
-    TArray<FVector> V;
-    TArray<int32>   I;
-    TArray<FVector> N;
-    TArray<FVector2D> UV;
-    TArray<FLinearColor> C;
-    TArray<FProcMeshTangent> T;
-
     // Naive mesher (Phase 3 path)
-    FVoxelMesher_Naive::BuildMesh(Chunk, BlockSize, V, I, N, UV, C, T);
+    FVoxelMeshSectionBuffers Groups[VOXEL_NUM_MESH_GROUPS];
+    FVoxelMesher_Naive::BuildMesh(Chunk, BlockSize, Groups);
 
-    BuildFromBuffers(V, I, N, UV, C, T, UseMaterial);
+    UMaterialInterface* Materials[VOXEL_NUM_RENDER_LAYERS];
+    for (UMaterialInterface*& M : Materials) M = UseMaterial;
+    BuildFromSections(Groups, CHUNK_ALL_SECTIONS, Materials);
 }
@@ -0,0 +1,403 @@
+#include "VoxelChunkMeshComponent.h"
+#include "PrimitiveSceneProxy.h"
+#include "PrimitiveViewRelevance.h"
+#include "SceneManagement.h"
+#include "LocalVertexFactory.h"
+#include "StaticMeshResources.h"
+#include "RawIndexBuffer.h"
+#include "MaterialDomain.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialRenderProxy.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "PhysicsEngine/PhysicsSettings.h"
+#include "Engine/World.h"
+#include "Runtime/Launch/Resources/Version.h"
+
+/** GPU resources for one section. Created on the game thread, released on the render thread. */
+class FVoxelChunkRenderSection
+{
+public:
+    FStaticMeshVertexBuffers VertexBuffers;
+    FRawStaticIndexBuffer    IndexBuffer;
+    FLocalVertexFactory      VertexFactory;
+    int32 NumVertices = 0;
+    int32 NumIndices = 0;
+
+    explicit FVoxelChunkRenderSection(ERHIFeatureLevel::Type FeatureLevel)
+        : IndexBuffer(/*InNeedsCPUAccess=*/false)
+        , VertexFactory(FeatureLevel, "FVoxelChunkRenderSection")
+    {
+    }
+
+    static TSharedPtr<FVoxelChunkRenderSection, ESPMode::ThreadSafe> Create(ERHIFeatureLevel::Type FeatureLevel, const FVoxelMeshSectionBuffers& B)
+    {
+        FVoxelChunkRenderSection* S = new FVoxelChunkRenderSection(FeatureLevel);
+        S->NumVertices = B.NumVertices();
+        S->NumIndices = B.Indices.Num();
+
+        // Fill the vertex buffers' CPU staging straight from the worker arrays. No CPU copy is
+        // kept after the RHI upload (collision keeps its own positions).
+        S->VertexBuffers.PositionVertexBuffer.Init(B.Positions, /*bInNeedsCPUAccess=*/false);
+        S->VertexBuffers.StaticMeshVertexBuffer.Init(S->NumVertices, /*NumTexCoords=*/1, /*bNeedsCPUAccess=*/false);
+        for (int32 i = 0; i < S->NumVertices; ++i)
+        {
+            const FVector3f TX = B.TangentX[i].ToFVector3f();
+            const FVector4f TZ = B.TangentZ[i].ToFVector4f();
+            const FVector3f TY = (FVector3f(TZ) ^ TX) * TZ.W;
+            S->VertexBuffers.StaticMeshVertexBuffer.SetVertexTangents(i, TX, TY, FVector3f(TZ));
+            S->VertexBuffers.StaticMeshVertexBuffer.SetVertexUV(i, 0, B.UVs[i]);
+        }
+        S->VertexBuffers.ColorVertexBuffer.InitFromColorArray(B.Colors, /*bInNeedsCPUAccess=*/false);
+
+        // 16-bit indices whenever the section fits
+        S->IndexBuffer.SetIndices(B.Indices, S->NumVertices <= (int32)MAX_uint16 + 1 ? EIndexBufferStride::Force16Bit : EIndexBufferStride::Force32Bit);
+
+        BeginInitResource(&S->VertexBuffers.PositionVertexBuffer);
+        BeginInitResource(&S->VertexBuffers.StaticMeshVertexBuffer);
+        BeginInitResource(&S->VertexBuffers.ColorVertexBuffer);
+        BeginInitResource(&S->IndexBuffer);
+
+        ENQUEUE_RENDER_COMMAND(VoxelChunkSectionInitVF)(
+            [S](FRHICommandListImmediate& RHICmdList)
+            {
+                FLocalVertexFactory::FDataType Data;
+                S->VertexBuffers.PositionVertexBuffer.BindPositionVertexBuffer(&S->VertexFactory, Data);
+                S->VertexBuffers.StaticMeshVertexBuffer.BindTangentVertexBuffer(&S->VertexFactory, Data);
+                S->VertexBuffers.StaticMeshVertexBuffer.BindPackedTexCoordVertexBuffer(&S->VertexFactory, Data);
+                S->VertexBuffers.StaticMeshVertexBuffer.BindLightMapVertexBuffer(&S->VertexFactory, Data, 0);
+                S->VertexBuffers.ColorVertexBuffer.BindColorVertexBuffer(&S->VertexFactory, Data);
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 3)
+                S->VertexFactory.SetData(RHICmdList, Data);
+                S->VertexFactory.InitResource(RHICmdList);
+#else
+                S->VertexFactory.SetData(Data);
+                S->VertexFactory.InitResource();
+#endif
+            });
+
+        // Last reference may drop on either thread; always release on the render thread.
+        return TSharedPtr<FVoxelChunkRenderSection, ESPMode::ThreadSafe>(S, [](FVoxelChunkRenderSection* Dead)
+            {
+                ENQUEUE_RENDER_COMMAND(VoxelChunkSectionRelease)(
+                    [Dead](FRHICommandListImmediate&)
+                    {
+                        Dead->VertexBuffers.PositionVertexBuffer.ReleaseResource();
+                        Dead->VertexBuffers.StaticMeshVertexBuffer.ReleaseResource();
+                        Dead->VertexBuffers.ColorVertexBuffer.ReleaseResource();
+                        Dead->IndexBuffer.ReleaseResource();
+                        Dead->VertexFactory.ReleaseResource();
+                        delete Dead;
+                    });
+            });
+    }
+};
+
+/** Static-relevance proxy: references the component's GPU sections, never copies them. */
+class FVoxelChunkSceneProxy final : public FPrimitiveSceneProxy
+{
+public:
+    struct FProxySection
+    {
+        TSharedPtr<FVoxelChunkRenderSection, ESPMode::ThreadSafe> Render;
+        UMaterialInterface* Material = nullptr;
+        int32 SectionIndex = 0;
+    };
+
+    FVoxelChunkSceneProxy(UVoxelChunkMeshComponent* Component, TArray<FProxySection>&& InSections)
+        : FPrimitiveSceneProxy(Component)
+        , Sections(MoveTemp(InSections))
+        , MaterialRelevance(Component->GetMaterialRelevance(GetScene().GetFeatureLevel()))
+    {
+    }
+
+    virtual SIZE_T GetTypeHash() const override
+    {
+        static size_t UniquePointer;
+        return reinterpret_cast<size_t>(&UniquePointer);
+    }
+
+    virtual void DrawStaticElements(FStaticPrimitiveDrawInterface* PDI) override
+    {
+        for (const FProxySection& Section : Sections)
+        {
+            const FVoxelChunkRenderSection& R = *Section.Render;
+
+            FMeshBatch Mesh;
+            Mesh.VertexFactory = &R.VertexFactory;
+            Mesh.MaterialRenderProxy = Section.Material->GetRenderProxy();
+            Mesh.ReverseCulling = IsLocalToWorldDeterminantNegative();
+            Mesh.Type = PT_TriangleList;
+            Mesh.DepthPriorityGroup = SDPG_World;
+            Mesh.LODIndex = 0;
+            Mesh.SegmentIndex = Section.SectionIndex;
+            Mesh.bCanApplyViewModeOverrides = false;
+
+            FMeshBatchElement& Element = Mesh.Elements[0];
+            Element.IndexBuffer = &R.IndexBuffer;
+            Element.PrimitiveUniformBuffer = GetUniformBuffer();
+            Element.FirstIndex = 0;
+            Element.NumPrimitives = R.NumIndices / 3;
+            Element.MinVertexIndex = 0;
+            Element.MaxVertexIndex = R.NumVertices - 1;
+
+            PDI->DrawMesh(Mesh, FLT_MAX);
+        }
+    }
+
+    virtual FPrimitiveViewRelevance GetViewRelevance(const FSceneView* View) const override
+    {
+        FPrimitiveViewRelevance Result;
+        Result.bDrawRelevance = IsShown(View);
+        Result.bShadowRelevance = IsShadowCast(View);
+        Result.bStaticRelevance = true;
+        Result.bRenderInMainPass = ShouldRenderInMainPass();
+        Result.bUsesLightingChannels = GetLightingChannelMask() != GetDefaultLightingChannelMask();
+        Result.bRenderCustomDepth = ShouldRenderCustomDepth();
+        MaterialRelevance.SetPrimitiveViewRelevance(Result);
+        return Result;
+    }
+
+    virtual bool CanBeOccluded() const override { return !MaterialRelevance.bDisableDepthTest; }
+    virtual uint32 GetMemoryFootprint() const override { return sizeof(*this) + GetAllocatedSize(); }
+
+private:
+    TArray<FProxySection> Sections;
+    FMaterialRelevance MaterialRelevance;
+};
+
+UVoxelChunkMeshComponent::UVoxelChunkMeshComponent(const FObjectInitializer& ObjectInitializer)
+    : Super(ObjectInitializer)
+{
+    PrimaryComponentTick.bCanEverTick = false;
+    Mobility = EComponentMobility::Static;
+}
+
+void UVoxelChunkMeshComponent::SetSection(int32 SectionIndex, FVoxelMeshSectionBuffers& Buffers, bool bCollision)
+{
+    if (SectionIndex < 0) return;
+
+    const bool bCook = ReplaceSection(SectionIndex, Buffers, bCollision);
+    UpdateLocalBounds();
+    if (bCook)
+    {
+        UpdateCollision();
+    }
+    MarkRenderStateDirty();
+}
+
+void UVoxelChunkMeshComponent::SetSections(TArrayView<FVoxelMeshSectionBuffers> Buffers, uint32 UpdateMask, uint32 CollisionMask)
+{
+    bool bCook = false;
+    for (int32 i = 0; i < Buffers.Num() && i < 32; ++i)
+    {
+        if ((UpdateMask & (1u << i)) == 0) continue;
+        bCook |= ReplaceSection(i, Buffers[i], (CollisionMask & (1u << i)) != 0);
+    }
+
+    UpdateLocalBounds();
+    if (bCook)
+    {
+        UpdateCollision();
+    }
+    MarkRenderStateDirty();
+}
+
+bool UVoxelChunkMeshComponent::ReplaceSection(int32 SectionIndex, FVoxelMeshSectionBuffers& Buffers, bool bCollision)
+{
+    if (Sections.Num() <= SectionIndex) Sections.SetNum(SectionIndex + 1);
+
+    FSectionState& S = Sections[SectionIndex];
+    const bool bHadCollision = S.CollisionIndices.Num() > 0;
+
+    S.Render.Reset();
+    S.Bounds = Buffers.Bounds;
+    if (!Buffers.IsEmpty())
+    {
+        const UWorld* World = GetWorld();
+        S.Render = FVoxelChunkRenderSection::Create(World ? World->GetFeatureLevel() : GMaxRHIFeatureLevel, Buffers);
+    }
+
+    if (bCollision && !Buffers.IsEmpty())
+    {
+        // Keep these for cooking; the caller gets the old collision storage back
+        Swap(S.CollisionPositions, Buffers.Positions);
+        Swap(S.CollisionIndices, Buffers.Indices);
+    }
+    else
+    {
+        S.CollisionPositions.Empty();
+        S.CollisionIndices.Empty();
+    }
+    Buffers.Reset();
+
+    return bHadCollision || S.CollisionIndices.Num() > 0;
+}
+
+void UVoxelChunkMeshComponent::ClearSection(int32 SectionIndex)
+{
+    if (!Sections.IsValidIndex(SectionIndex)) return;
+    FVoxelMeshSectionBuffers Empty;
+    SetSection(SectionIndex, Empty, false);
+}
+
+void UVoxelChunkMeshComponent::ReleaseCollisionStorage(FVoxelMeshBufferPool& Pool)
+{
+    // The body setup cooked from these already has its own copy
+    for (FSectionState& S : Sections)
+    {
+        Pool.ReleaseCollision(MoveTemp(S.CollisionPositions), MoveTemp(S.CollisionIndices));
+    }
+}
+
+void UVoxelChunkMeshComponent::SetSectionVisible(int32 SectionIndex, bool bVisible)
+{
+    if (!Sections.IsValidIndex(SectionIndex) || Sections[SectionIndex].bVisible == bVisible) return;
+    Sections[SectionIndex].bVisible = bVisible;
+    MarkRenderStateDirty();
+}
+
+void UVoxelChunkMeshComponent::ClearAllSections()
+{
+    Sections.Empty();
+    UpdateLocalBounds();
+    UpdateCollision();
+    MarkRenderStateDirty();
+}
+
+FPrimitiveSceneProxy* UVoxelChunkMeshComponent::CreateSceneProxy()
+{
+    TArray<FVoxelChunkSceneProxy::FProxySection> ProxySections;
+    for (int32 i = 0; i < Sections.Num(); ++i)
+    {
+        if (!Sections[i].Render.IsValid() || !Sections[i].bVisible) continue;
+
+        FVoxelChunkSceneProxy::FProxySection& P = ProxySections.AddDefaulted_GetRef();
+        P.Render = Sections[i].Render;
+        P.SectionIndex = i;
+        P.Material = GetMaterial(GetMaterialSlotForSection(i));
+        if (!P.Material) P.Material = UMaterial::GetDefaultMaterial(MD_Surface);
+    }
+    if (ProxySections.Num() == 0) return nullptr;
+
+    return new FVoxelChunkSceneProxy(this, MoveTemp(ProxySections));
+}
+
+int32 UVoxelChunkMeshComponent::GetNumMaterials() const
+{
+    return NumMaterialSlots > 0 ? NumMaterialSlots : Sections.Num();
+}
+
+void UVoxelChunkMeshComponent::UpdateLocalBounds()
+{
+    FBox3f Box(ForceInit);
+    for (const FSectionState& S : Sections)
+    {
+        if (S.Bounds.IsValid) Box += S.Bounds;
+    }
+    LocalBounds = Box.IsValid ? FBox(Box) : FBox(FVector::ZeroVector, FVector::ZeroVector);
+    UpdateBounds();
+    MarkRenderTransformDirty();
+}
+
+FBoxSphereBounds UVoxelChunkMeshComponent::CalcBounds(const FTransform& LocalToWorld) const
+{
+    return FBoxSphereBounds(LocalBounds).TransformBy(LocalToWorld);
+}
+
+bool UVoxelChunkMeshComponent::GetPhysicsTriMeshData(FTriMeshCollisionData* CollisionData, bool InUseAllTriData)
+{
+    int32 VertexBase = 0;
+    for (int32 SectionIdx = 0; SectionIdx < Sections.Num(); ++SectionIdx)
+    {
+        const FSectionState& S = Sections[SectionIdx];
+        if (S.CollisionIndices.Num() == 0) continue;
+
+        CollisionData->Vertices.Append(S.CollisionPositions);
+
+        const int32 NumTriangles = S.CollisionIndices.Num() / 3;
+        for (int32 TriIdx = 0; TriIdx < NumTriangles; ++TriIdx)
+        {
+            FTriIndices Triangle;
+            Triangle.v0 = S.CollisionIndices[TriIdx * 3 + 0] + VertexBase;
+            Triangle.v1 = S.CollisionIndices[TriIdx * 3 + 1] + VertexBase;
+            Triangle.v2 = S.CollisionIndices[TriIdx * 3 + 2] + VertexBase;
+            CollisionData->Indices.Add(Triangle);
+            CollisionData->MaterialIndices.Add(GetMaterialSlotForSection(SectionIdx));
+        }
+        VertexBase = CollisionData->Vertices.Num();
+    }
+
+    CollisionData->bFlipNormals = true;
+    CollisionData->bDeformableMesh = true;
+    CollisionData->bFastCook = true;
+    return true;
+}
+
+bool UVoxelChunkMeshComponent::ContainsPhysicsTriMeshData(bool InUseAllTriData) const
+{
+    for (const FSectionState& S : Sections)
+    {
+        if (S.CollisionIndices.Num() >= 3) return true;
+    }
+    return false;
+}
+
+UBodySetup* UVoxelChunkMeshComponent::CreateBodySetupHelper()
+{
+    UBodySetup* NewBodySetup = NewObject<UBodySetup>(this, NAME_None, (IsTemplate() ? RF_Public | RF_ArchetypeObject : RF_NoFlags));
+    NewBodySetup->BodySetupGuid = FGuid::NewGuid();
+    NewBodySetup->bGenerateMirroredCollision = false;
+    NewBodySetup->bDoubleSidedGeometry = true;
+    NewBodySetup->CollisionTraceFlag = CTF_UseComplexAsSimple;
+    return NewBodySetup;
+}
+
+UBodySetup* UVoxelChunkMeshComponent::GetBodySetup()
+{
+    if (!BodySetup)
+    {
+        BodySetup = CreateBodySetupHelper();
+    }
+    return BodySetup;
+}
+
+void UVoxelChunkMeshComponent::UpdateCollision()
+{
+    UWorld* World = GetWorld();
+    const bool bUseAsyncCook = World && World->IsGameWorld() && bUseAsyncCooking;
+
+    if (bUseAsyncCook)
+    {
+        UBodySetup* NewSetup = CreateBodySetupHelper();
+        AsyncBodySetupQueue.Add(NewSetup);
+        NewSetup->CreatePhysicsMeshesAsync(FOnAsyncPhysicsCookFinished::CreateUObject(this, &UVoxelChunkMeshComponent::FinishPhysicsAsyncCook, NewSetup));
+    }
+    else
+    {
+        AsyncBodySetupQueue.Empty();
+        UBodySetup* UseSetup = GetBodySetup();
+        UseSetup->BodySetupGuid = FGuid::NewGuid();
+        UseSetup->bHasCookedCollisionData = true;
+        UseSetup->InvalidatePhysicsData();
+        UseSetup->CreatePhysicsMeshes();
+        RecreatePhysicsState();
+    }
+}
+
+void UVoxelChunkMeshComponent::FinishPhysicsAsyncCook(bool bSuccess, UBodySetup* FinishedBodySetup)
+{
+    const int32 FoundIdx = AsyncBodySetupQueue.Find(FinishedBodySetup);
+    if (FoundIdx == INDEX_NONE) return;
+
+    if (bSuccess)
+    {
+        // Newest finished cook wins; anything older is obsolete
+        BodySetup = FinishedBodySetup;
+        RecreatePhysicsState();
+        AsyncBodySetupQueue.RemoveAt(0, FoundIdx + 1);
+    }
+    else
+    {
+        AsyncBodySetupQueue.RemoveAt(FoundIdx);
+    }
+}
@@ -0,0 +1,199 @@
+#include "VoxelEditJournal.h"
+#include "VoxelSaveSystem.h"     // GetWorldDir
+#include "HAL/RunnableThread.h"
+#include "HAL/PlatformFileManager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
+#include "HAL/Event.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+static constexpr uint32 VCJ_MAGIC = 0x4A435631; // 'VCJ1'
+static constexpr uint16 VCJ_VER = 2;
+static constexpr uint16 VCJ_VER_SINGLE = 1;
+static constexpr int32 VCJ_HEADER_BYTES = 6;
+
+// Record = int32 chunk X, int32 chunk Z, int32 first index, uint16 count, uint8 old, uint8 new,
+// uint32 transaction, int64 timestamp; little-endian, unaligned. A record covers count
+// consecutive indices with the same old and new id, so filled volumes stay small.
+static constexpr int32 VCJ_RECORD_BYTES = 28;
+
+// v1 records were one voxel each: chunk X/Z, index, old, new, transaction, timestamp, padding
+static constexpr int32 VCJ_RECORD_BYTES_SINGLE = 30;
+
+static FString JournalPath(int32 Seed)
+{
+    return FPaths::Combine(VoxelSaveSystem::GetWorldDir(Seed), TEXT("Edits.vcj"));
+}
+
+FVoxelEditJournal::FVoxelEditJournal(int32 InSeed)
+    : Seed(InSeed)
+{
+    WakeEvent = FPlatformProcess::GetSynchEventFromPool(false);
+    Thread = FRunnableThread::Create(this, TEXT("VoxelEditJournal"), 0, TPri_BelowNormal);
+}
+
+FVoxelEditJournal::~FVoxelEditJournal()
+{
+    if (Thread)
+    {
+        Stop();
+        Thread->WaitForCompletion();
+        delete Thread;
+        Thread = nullptr;
+    }
+    FPlatformProcess::ReturnSynchEventToPool(WakeEvent);
+    WakeEvent = nullptr;
+}
+
+void FVoxelEditJournal::Append(TConstArrayView<FVoxelEditRecord> Edits, uint32 Transaction)
+{
+    if (Edits.Num() == 0) return;
+
+    FBatch Batch;
+    Batch.Transaction = Transaction;
+    Batch.Timestamp = FDateTime::UtcNow().GetTicks();
+    Batch.Records = Edits;
+    Queue.Enqueue(MoveTemp(Batch));
+    WakeEvent->Trigger();
+}
+
+void FVoxelEditJournal::Stop()
+{
+    bStopping = true;
+    WakeEvent->Trigger();
+}
+
+uint32 FVoxelEditJournal::Run()
+{
+    const FString Path = JournalPath(Seed);
+    IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
+    const bool bFresh = PF.FileSize(*Path) < VCJ_HEADER_BYTES;
+
+    TUniquePtr<IFileHandle> File(PF.OpenWrite(*Path, /*bAppend=*/!bFresh));
+    if (!File)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("VoxelJournal: cannot open %s; edits are only saved on unload"), *Path);
+    }
+    else if (bFresh)
+    {
+        uint8 Header[VCJ_HEADER_BYTES];
+        const uint32 Magic = INTEL_ORDER32(VCJ_MAGIC);
+        const uint16 Ver = INTEL_ORDER16(VCJ_VER);
+        FMemory::Memcpy(Header, &Magic, 4);
+        FMemory::Memcpy(Header + 4, &Ver, 2);
+        File->Write(Header, VCJ_HEADER_BYTES);
+        File->Flush();
+    }
+
+    TArray<uint8> Scratch;
+    while (!bStopping)
+    {
+        WakeEvent->Wait(100);
+        WritePending(File.Get(), Scratch);
+    }
+
+    // Anything queued before Stop
+    WritePending(File.Get(), Scratch);
+    return 0;
+}
+
+void FVoxelEditJournal::WritePending(IFileHandle* File, TArray<uint8>& Scratch)
+{
+    // Everything queued since the last wake goes out in one write + flush
+    Scratch.Reset();
+    FBatch Batch;
+    while (Queue.Dequeue(Batch))
+    {
+        if (!File) continue;
+
+        const uint32 Txn = INTEL_ORDER32(Batch.Transaction);
+        const int64 Ticks = INTEL_ORDER64(Batch.Timestamp);
+        const TArray<FVoxelEditRecord>& Records = Batch.Records;
+        for (int32 i = 0; i < Records.Num();)
+        {
+            // Fold the following records into this one while they continue its run
+            const FVoxelEditRecord& R = Records[i];
+            int32 Count = 1;
+            while (i + Count < Records.Num() && Count < MAX_uint16)
+            {
+                const FVoxelEditRecord& Next = Records[i + Count];
+                if (!(Next.Key == R.Key) || Next.Index != R.Index + Count || Next.OldId != R.OldId || Next.NewId != R.NewId) break;
+                ++Count;
+            }
+
+            uint8* Ptr = Scratch.GetData() + Scratch.AddUninitialized(VCJ_RECORD_BYTES);
+            const int32 Fields[3] = { INTEL_ORDER32(R.Key.X), INTEL_ORDER32(R.Key.Z), INTEL_ORDER32(R.Index) };
+            const uint16 N = INTEL_ORDER16((uint16)Count);
+            FMemory::Memcpy(Ptr, Fields, 12);
+            FMemory::Memcpy(Ptr + 12, &N, 2);
+            Ptr[14] = R.OldId;
+            Ptr[15] = R.NewId;
+            FMemory::Memcpy(Ptr + 16, &Txn, 4);
+            FMemory::Memcpy(Ptr + 20, &Ticks, 8);
+            i += Count;
+        }
+    }
+
+    if (File && Scratch.Num() > 0)
+    {
+        File->Write(Scratch.GetData(), Scratch.Num());
+        File->Flush();
+    }
+}
+
+bool FVoxelEditJournal::Load(int32 Seed, TArray<FVoxelJournalEntry>& Out)
+{
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *JournalPath(Seed), FILEREAD_Silent)) return false;
+    if (Bytes.Num() < VCJ_HEADER_BYTES) return false;
+
+    uint32 Magic = 0; uint16 Ver = 0;
+    FMemory::Memcpy(&Magic, Bytes.GetData(), 4);
+    FMemory::Memcpy(&Ver, Bytes.GetData() + 4, 2);
+    Ver = INTEL_ORDER16(Ver);
+    if (INTEL_ORDER32(Magic) != VCJ_MAGIC || (Ver != VCJ_VER && Ver != VCJ_VER_SINGLE)) return false;
+    const bool bRuns = Ver == VCJ_VER;
+    const int32 RecordBytes = bRuns ? VCJ_RECORD_BYTES : VCJ_RECORD_BYTES_SINGLE;
+    const int32 IdsAt = bRuns ? 14 : 12;
+
+    // A crash mid-write can leave a partial record at the end; it is simply ignored
+    const int32 Count = (Bytes.Num() - VCJ_HEADER_BYTES) / RecordBytes;
+    Out.Reset(Count);
+
+    const uint8* Ptr = Bytes.GetData() + VCJ_HEADER_BYTES;
+    for (int32 i = 0; i < Count; ++i, Ptr += RecordBytes)
+    {
+        int32 Fields[3];
+        uint16 N = 1;
+        uint32 Txn;
+        int64 Ticks;
+        FMemory::Memcpy(Fields, Ptr, 12);
+        if (bRuns)
+        {
+            FMemory::Memcpy(&N, Ptr + 12, 2);
+            N = INTEL_ORDER16(N);
+        }
+        FMemory::Memcpy(&Txn, Ptr + IdsAt + 2, 4);
+        FMemory::Memcpy(&Ticks, Ptr + IdsAt + 6, 8);
+
+        const int32 Index = INTEL_ORDER32(Fields[2]);
+        if (Index < 0 || (int64)Index + N > CHUNK_VOLUME) continue;
+
+        for (int32 k = 0; k < N; ++k)
+        {
+            FVoxelJournalEntry& E = Out.AddDefaulted_GetRef();
+            E.Edit.Key = FChunkKey(INTEL_ORDER32(Fields[0]), INTEL_ORDER32(Fields[1]));
+            E.Edit.Index = Index + k;
+            E.Edit.OldId = Ptr[IdsAt];
+            E.Edit.NewId = Ptr[IdsAt + 1];
+            E.Transaction = INTEL_ORDER32(Txn);
+            E.Timestamp = INTEL_ORDER64(Ticks);
+        }
+    }
+    return true;
+}
+
+void FVoxelEditJournal::Discard(int32 Seed)
+{
+    IFileManager::Get().Delete(*JournalPath(Seed), /*RequireExists=*/false, /*EvenReadOnly=*/true, /*Quiet=*/true);
+}
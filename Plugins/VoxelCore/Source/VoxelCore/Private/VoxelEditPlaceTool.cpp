@@ -56,26 +56,18 @@ void AVoxelEditPlaceTool::TryPlace()
     APlayerController* PC = UGameplayStatics::GetPlayerController(this, 0);
     FVector O; FRotator R; PC->GetPlayerViewPoint(O, R);
     const FVector D = R.Vector().GetSafeNormal();
-    const FVector End = O + D * MaxRange;
 
-    // Raycast against chunk meshes (to get the face were targeting)
-    FHitResult Hit;
-    FCollisionQueryParams Params(SCENE_QUERY_STAT(VoxelPlaceTrace), false, this);
-    Params.bTraceComplex = true;
-    if (!GetWorld()->LineTraceSingleByChannel(Hit, O, End, ECC_Visibility, Params))
+    // Voxel raycast (to get the face were targeting); no dependency on cooked collision
+    FVoxelRayHit Hit;
+    if (!WorldManager->RaycastVoxels(O, D, MaxRange, Hit))
         return;
 
     // Persist the click ray
     DrawDebugLine(GetWorld(), O, Hit.ImpactPoint, FColor::Green, /*bPersistent=*/true, /*LifeTime=*/0.f, 0, 2.0f);
 
-    // Place on the air side: nudge a hair opposite the ray into empty space
-    const float   Eps = FMath::Max(1.f, WorldManager->BlockSize * 0.01f);
-    const FVector POutside = Hit.ImpactPoint - D * Eps;
-    DrawDebugPoint(GetWorld(), POutside, 8.f, FColor::Yellow, /*bPersistent=*/true, /*LifeTime=*/0.f);
-
-    // Map world ? (chunk key, local x/y/z) using the centered grid
+    // Place on the air side: the neighbour across the face the ray entered through
     FChunkKey Key; int32 X = 0, Y = 0, Z = 0;
-    if (!WorldManager->WorldToVoxel_Centered(POutside, Key, X, Y, Z))
+    if (!Hit.GetAdjacent(Key, X, Y, Z))
         return;
 
     const bool OK = WorldManager->PlaceBlock_Local(Key, X, Y, Z, PlaceBlockId);
@@ -38,30 +38,17 @@ void AVoxelEditRemoveTool::TryRemove()
     FVector O; FRotator R;
     PC->GetPlayerViewPoint(O, R);
     const FVector D = R.Vector().GetSafeNormal();
-    const FVector End = O + D * MaxRange;
 
-    // Raycast against chunk meshes
-    FHitResult Hit;
-    FCollisionQueryParams Params(SCENE_QUERY_STAT(VoxelRemoveTrace), false, this);
-    Params.bTraceComplex = true;
-    if (!GetWorld()->LineTraceSingleByChannel(Hit, O, End, ECC_Visibility, Params))
+    // Voxel raycast: the hit cell is the clicked block, no collision or epsilon nudging needed
+    FVoxelRayHit Hit;
+    if (!WorldManager->RaycastVoxels(O, D, MaxRange, Hit))
         return;
 
     // Persist the click ray
     DrawDebugLine(GetWorld(), O, Hit.ImpactPoint, FColor::Red, /*bPersistentLines=*/true, /*LifeTime=*/0.f, 0, 2.0f);
 
-    // Push a hair *into* the block along the ray ? deterministic interior sample
-    const float   Eps = FMath::Max(1.f, WorldManager->BlockSize * 0.01f);
-    const FVector PInside = Hit.ImpactPoint + D * Eps;   // +D = inside the clicked voxel
-    DrawDebugPoint(GetWorld(), PInside, 8.f, FColor::Yellow, /*bPersistent=*/true, /*LifeTime=*/0.f);
-
-    // Map world ? (chunk key, local x/y/z) using centered grid
-    FChunkKey Key; int32 X = 0, Y = 0, Z = 0;
-    if (!WorldManager->WorldToVoxel_Centered(PInside, Key, X, Y, Z))
-        return;
-
     // Clear that cell and rebuild
-    const bool OK = WorldManager->RemoveBlock_Local(Key, X, Y, Z);
+    const bool OK = WorldManager->RemoveBlock_Local(Hit.Key, Hit.X, Hit.Y, Hit.Z);
 
     if (bDebug)
     {
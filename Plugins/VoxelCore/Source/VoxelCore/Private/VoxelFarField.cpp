@@ -0,0 +1,137 @@
+#include "VoxelFarField.h"
+#include "VoxelGenerator.h"
+#include "VoxelBlockRegistry.h"
+#include "VoxelSaveSystem.h"  // FVoxelColumnSummary
+#include "VoxelTypes.h"
+#include "ChunkConfig.h"
+
+namespace VoxelFarField
+{
+    FChunkKey ChunkToTile(const FChunkKey& Chunk, int32 TileChunks)
+    {
+        return FChunkKey(FloorDiv(Chunk.X, TileChunks), FloorDiv(Chunk.Z, TileChunks));
+    }
+
+    void BuildTileMesh(const FVoxelGeneratorConfig& Config, const FChunkKey& Tile,
+        const FVoxelFarTileSettings& Settings, TArrayView<FVoxelMeshSectionBuffers> Out)
+    {
+        const int32 TileVoxels = Settings.TileChunks * CHUNK_SIZE_X;
+        int32 Step = FMath::Clamp(Settings.StepVoxels, 1, CHUNK_SIZE_X);
+        while (CHUNK_SIZE_X % Step != 0) --Step; // keep chunk (and tile) edges on shared samples
+        const int32 N = TileVoxels / Step;           // quads per side
+        const int32 NC = CHUNK_SIZE_X / Step;        // quads per side of one chunk's section
+        const int32 S = N + 1;                       // samples per side (shared with the next tile)
+        const int32 GX0 = Tile.X * TileVoxels;
+        const int32 GZ0 = Tile.Z * Settings.TileChunks * CHUNK_SIZE_Z;
+
+        const float BS = Settings.BlockSize;
+        const float TopOffset = BS * 0.5f - Settings.DropUU; // top face of the column, sunk a little
+
+        FVoxelGenerator Gen(Config);
+
+        // One summary lookup per chunk touched; most far chunks were never saved.
+        TMap<FChunkKey, TSharedPtr<FVoxelColumnSummary>> Summaries;
+        auto FindSummary = [&](const FChunkKey& Key) -> const FVoxelColumnSummary*
+            {
+                if (const TSharedPtr<FVoxelColumnSummary>* Found = Summaries.Find(Key))
+                {
+                    return Found->Get();
+                }
+                TSharedPtr<FVoxelColumnSummary> Loaded = MakeShared<FVoxelColumnSummary>();
+                if (!VoxelSaveSystem::LoadColumnSummary(Config.Seed, Key, *Loaded)) Loaded.Reset();
+                return Summaries.Add(Key, Loaded).Get();
+            };
+
+        TArray<float> Heights;
+        TArray<uint8> Ids;
+        Heights.SetNumUninitialized(S * S);
+        Ids.SetNumUninitialized(S * S);
+
+        for (int32 j = 0; j < S; ++j)
+        {
+            for (int32 i = 0; i < S; ++i)
+            {
+                const int32 GX = GX0 + i * Step;
+                const int32 GZ = GZ0 + j * Step;
+
+                int32 LX = 0, LZ = 0;
+                const FChunkKey Chunk = GlobalToChunkLocal(GX, GZ, LX, LZ);
+
+                int32 TopY;
+                uint8 TopId;
+                if (const FVoxelColumnSummary* Sum = FindSummary(Chunk))
+                {
+                    TopY = Sum->TopY[LX + LZ * CHUNK_SIZE_X];
+                    TopId = Sum->TopId[LX + LZ * CHUNK_SIZE_X];
+                }
+                else
+                {
+                    TopY = Gen.GetColumnTopY(GX, GZ);
+                    TopId = (uint8)EBlockId::Grass;
+                }
+
+                Heights[i + j * S] = TopY * BS + TopOffset;
+                Ids[i + j * S] = TopId;
+            }
+        }
+
+        check(Out.Num() == Settings.TileChunks * Settings.TileChunks);
+        for (FVoxelMeshSectionBuffers& Section : Out)
+        {
+            Section.Reset(NC * NC * 4, NC * NC * 6);
+        }
+
+        const float Span = Step * BS;
+        for (int32 j = 0; j < N; ++j)
+        {
+            for (int32 i = 0; i < N; ++i)
+            {
+                FVoxelMeshSectionBuffers& Sec = Out[(i / NC) + (j / NC) * Settings.TileChunks];
+                const float H00 = Heights[i + j * S];
+                const float H10 = Heights[(i + 1) + j * S];
+                const float H11 = Heights[(i + 1) + (j + 1) * S];
+                const float H01 = Heights[i + (j + 1) * S];
+
+                // Corner order and winding match the mesher's top face
+                const float X0 = i * Span, X1 = (i + 1) * Span;
+                const float Y0 = j * Span, Y1 = (j + 1) * Span;
+                const uint32 Base = (uint32)Sec.Positions.Num();
+                const FVector3f P[4] = { FVector3f(X0, Y0, H00), FVector3f(X1, Y0, H10), FVector3f(X1, Y1, H11), FVector3f(X0, Y1, H01) };
+                for (const FVector3f& V : P)
+                {
+                    Sec.Positions.Add(V);
+                    Sec.Bounds += V;
+                }
+
+                Sec.Indices.Add(Base + 0);
+                Sec.Indices.Add(Base + 2);
+                Sec.Indices.Add(Base + 1);
+                Sec.Indices.Add(Base + 0);
+                Sec.Indices.Add(Base + 3);
+                Sec.Indices.Add(Base + 2);
+
+                const float DX = ((H10 + H11) - (H00 + H01)) * 0.5f;
+                const float DY = ((H01 + H11) - (H00 + H10)) * 0.5f;
+                const FPackedNormal Normal(FVector4f(FVector3f(-DX, -DY, Span).GetSafeNormal(), 1.0f));
+                const FPackedNormal Tangent(FVector3f(Span, 0.f, DX).GetSafeNormal());
+
+                // Top face texture/tint of the column's top block
+                const uint8 Id = Ids[i + j * S];
+                constexpr int32 Top = (int32)EVoxelFace::PosY;
+                const FVoxelAtlasRect& Rect = VoxelBlocks::GetTileRect(VoxelBlocks::Get(Id).FaceTile[Top]);
+                Sec.UVs.Add(FVector2f(Rect.U0, Rect.V1));
+                Sec.UVs.Add(FVector2f(Rect.U1, Rect.V1));
+                Sec.UVs.Add(FVector2f(Rect.U1, Rect.V0));
+                Sec.UVs.Add(FVector2f(Rect.U0, Rect.V0));
+
+                const FColor Color = VoxelBlocks::GetFaceColor(Id, Top);
+                for (int32 c = 0; c < 4; ++c)
+                {
+                    Sec.TangentX.Add(Tangent);
+                    Sec.TangentZ.Add(Normal);
+                    Sec.Colors.Add(Color);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,239 @@
+#include "VoxelFeatures.h"
+#include "VoxelGenerator.h"
+#include "VoxelChunk.h"
+#include "Math/RandomStream.h"
+
+namespace
+{
+    constexpr int32 REGION_VOXELS_X = FEATURE_REGION_CHUNKS * CHUNK_SIZE_X;
+    constexpr int32 REGION_VOXELS_Z = FEATURE_REGION_CHUNKS * CHUNK_SIZE_Z;
+
+    // Per-type salts keep each feature type on its own random stream, so tuning one type
+    // (e.g. ore count) never moves the others.
+    constexpr uint32 SALT_TREE = 0x7A3E11u;
+    constexpr uint32 SALT_ORE = 0x0DE5A1u;
+    constexpr uint32 SALT_BOULDER = 0xB01D3Fu;
+
+    FRandomStream MakeStream(int32 Seed, const FIntPoint& Region, uint32 Salt)
+    {
+        uint32 H = HashCombine(::GetTypeHash(Seed), ::GetTypeHash(Region.X));
+        H = HashCombine(H, ::GetTypeHash(Region.Y));
+        H = HashCombine(H, Salt);
+        return FRandomStream(static_cast<int32>(H));
+    }
+
+    void FinalizeBounds(FVoxelFeature& F)
+    {
+        F.Min = FIntVector(MAX_int32);
+        F.Max = FIntVector(MIN_int32);
+        for (const FVoxelFeatureBlock& B : F.Blocks)
+        {
+            F.Min = FIntVector(FMath::Min(F.Min.X, B.Pos.X), FMath::Min(F.Min.Y, B.Pos.Y), FMath::Min(F.Min.Z, B.Pos.Z));
+            F.Max = FIntVector(FMath::Max(F.Max.X, B.Pos.X), FMath::Max(F.Max.Y, B.Pos.Y), FMath::Max(F.Max.Z, B.Pos.Z));
+        }
+    }
+
+    void AddBlock(FVoxelFeature& F, int32 X, int32 Y, int32 Z, EBlockId Id, EVoxelFeatureReplace Replace)
+    {
+        if (Y < 0 || Y >= CHUNK_SIZE_Y) return;
+        FVoxelFeatureBlock& B = F.Blocks.AddDefaulted_GetRef();
+        B.Pos = FIntVector(X, Y, Z);
+        B.Id = static_cast<uint8>(Id);
+        B.Replace = Replace;
+    }
+
+    void PlanTrees(const FVoxelGenerator& Gen, const FIntPoint& Region, TArray<FVoxelFeature>& Out)
+    {
+        FRandomStream Rng = MakeStream(Gen.GetSeed(), Region, SALT_TREE);
+        const int32 Attempts = 10;
+        const int32 CanopyR = 2;
+
+        for (int32 i = 0; i < Attempts; ++i)
+        {
+            // Always draw the same number of values per attempt so rejections don't shift later trees.
+            const int32 WX = Region.X * REGION_VOXELS_X + Rng.RandRange(0, REGION_VOXELS_X - 1);
+            const int32 WZ = Region.Y * REGION_VOXELS_Z + Rng.RandRange(0, REGION_VOXELS_Z - 1);
+            const int32 TrunkH = Rng.RandRange(4, 6);
+            const int32 CornerMask = Rng.RandRange(0, 15);
+
+            const int32 Top = Gen.GetColumnTopY(WX, WZ);
+            if (Top + TrunkH + 2 >= CHUNK_SIZE_Y) continue;
+
+            FVoxelFeature F;
+            F.Type = EVoxelFeatureType::Tree;
+
+            const int32 CrownY = Top + TrunkH;
+            for (int32 Y = CrownY - 2; Y <= CrownY + 1; ++Y)
+            {
+                const int32 R = (Y <= CrownY - 1) ? CanopyR : 1;
+                for (int32 DZ = -R; DZ <= R; ++DZ)
+                {
+                    for (int32 DX = -R; DX <= R; ++DX)
+                    {
+                        const bool bCorner = FMath::Abs(DX) == R && FMath::Abs(DZ) == R;
+                        if (bCorner)
+                        {
+                            // Trim corners: always on the top layers, per-tree on the wide layers
+                            if (R == 1) continue;
+                            const int32 Bit = (DX > 0 ? 1 : 0) | (DZ > 0 ? 2 : 0);
+                            if (CornerMask & (1 << Bit)) continue;
+                        }
+                        if (DX == 0 && DZ == 0 && Y <= CrownY) continue; // trunk column
+                        AddBlock(F, WX + DX, Y, WZ + DZ, EBlockId::Leaves, EVoxelFeatureReplace::AirOnly);
+                    }
+                }
+            }
+            for (int32 Y = Top + 1; Y <= CrownY; ++Y)
+            {
+                AddBlock(F, WX, Y, WZ, EBlockId::Log, EVoxelFeatureReplace::AirOrLeaves);
+            }
+
+            FinalizeBounds(F);
+            Out.Add(MoveTemp(F));
+        }
+    }
+
+    void PlanOreVeins(const FVoxelGenerator& Gen, const FIntPoint& Region, TArray<FVoxelFeature>& Out)
+    {
+        FRandomStream Rng = MakeStream(Gen.GetSeed(), Region, SALT_ORE);
+        const int32 Veins = 12;
+        const int32 MaxSteps = 10;
+        const int32 Reach = FEATURE_MAX_SPILL - 1;
+
+        for (int32 i = 0; i < Veins; ++i)
+        {
+            const int32 WX = Region.X * REGION_VOXELS_X + Rng.RandRange(0, REGION_VOXELS_X - 1);
+            const int32 WZ = Region.Y * REGION_VOXELS_Z + Rng.RandRange(0, REGION_VOXELS_Z - 1);
+            const float DepthT = Rng.GetFraction();
+            const int32 Steps = Rng.RandRange(5, MaxSteps);
+
+            const int32 Top = Gen.GetColumnTopY(WX, WZ);
+            const int32 MaxY = Top - 4;
+
+            FVoxelFeature F;
+            F.Type = EVoxelFeatureType::OreVein;
+
+            int32 X = 0, Y = FMath::Max(1, FMath::RoundToInt(DepthT * MaxY)), Z = 0;
+            for (int32 s = 0; s < MaxSteps; ++s)
+            {
+                // Consume a fixed number of draws per vein regardless of Steps/MaxY
+                const int32 Axis = Rng.RandRange(0, 2);
+                const int32 Dir = Rng.RandBool() ? 1 : -1;
+                if (s >= Steps || MaxY < 2) continue;
+
+                AddBlock(F, WX + X, Y, WZ + Z, EBlockId::CoalOre, EVoxelFeatureReplace::StoneOnly);
+                if (Axis == 0) X = FMath::Clamp(X + Dir, -Reach, Reach);
+                else if (Axis == 1) Y = FMath::Clamp(Y + Dir, 1, MaxY);
+                else Z = FMath::Clamp(Z + Dir, -Reach, Reach);
+            }
+
+            if (F.Blocks.Num() == 0) continue;
+            FinalizeBounds(F);
+            Out.Add(MoveTemp(F));
+        }
+    }
+
+    void PlanBoulders(const FVoxelGenerator& Gen, const FIntPoint& Region, TArray<FVoxelFeature>& Out)
+    {
+        FRandomStream Rng = MakeStream(Gen.GetSeed(), Region, SALT_BOULDER);
+        const float Chance = Rng.GetFraction();
+        const int32 WX = Region.X * REGION_VOXELS_X + Rng.RandRange(0, REGION_VOXELS_X - 1);
+        const int32 WZ = Region.Y * REGION_VOXELS_Z + Rng.RandRange(0, REGION_VOXELS_Z - 1);
+        const int32 R = Rng.RandRange(1, 2);
+        if (Chance > 0.35f) return;
+
+        const int32 Top = Gen.GetColumnTopY(WX, WZ);
+        const int32 CY = Top + 1;
+        const float Limit = R * R + R * 0.5f;
+
+        FVoxelFeature F;
+        F.Type = EVoxelFeatureType::Boulder;
+        for (int32 DY = -R; DY <= R; ++DY)
+            for (int32 DZ = -R; DZ <= R; ++DZ)
+                for (int32 DX = -R; DX <= R; ++DX)
+                {
+                    if (DX * DX + DY * DY + DZ * DZ > Limit) continue;
+                    AddBlock(F, WX + DX, CY + DY, WZ + DZ, EBlockId::Stone, EVoxelFeatureReplace::AirOnly);
+                }
+
+        if (F.Blocks.Num() == 0) return;
+        FinalizeBounds(F);
+        Out.Add(MoveTemp(F));
+    }
+
+    FORCEINLINE bool CanReplace(uint8 Current, EVoxelFeatureReplace Rule)
+    {
+        switch (Rule)
+        {
+        case EVoxelFeatureReplace::AirOnly:     return Current == static_cast<uint8>(EBlockId::Air);
+        case EVoxelFeatureReplace::StoneOnly:   return Current == static_cast<uint8>(EBlockId::Stone);
+        case EVoxelFeatureReplace::AirOrLeaves: return Current == static_cast<uint8>(EBlockId::Air)
+                                                    || Current == static_cast<uint8>(EBlockId::Leaves);
+        default: return false;
+        }
+    }
+}
+
+namespace VoxelFeatures
+{
+    TSharedPtr<const FVoxelFeatureRegion> BuildRegion(const FVoxelGenerator& Gen, const FIntPoint& Region)
+    {
+        TSharedPtr<FVoxelFeatureRegion> Out = MakeShared<FVoxelFeatureRegion>();
+        Out->Coord = Region;
+
+        // Stamp order = plan order: ores first (underground), then boulders, then trees on top.
+        PlanOreVeins(Gen, Region, Out->Features);
+        PlanBoulders(Gen, Region, Out->Features);
+        PlanTrees(Gen, Region, Out->Features);
+        return Out;
+    }
+
+    void DecorateChunk(const FVoxelGenerator& Gen, FVoxelFeatureCache* Cache, const FChunkKey& Key, FVoxelChunkData& Chunk)
+    {
+        if (Chunk.Blocks.Num() != CHUNK_VOLUME) return;
+        if (Cache && Cache->GetConfigHash() != Gen.GetConfig().GetHash()) Cache = nullptr;
+
+        const int32 MinX = Key.X * CHUNK_SIZE_X;
+        const int32 MinZ = Key.Z * CHUNK_SIZE_Z;
+        const int32 MaxX = MinX + CHUNK_SIZE_X - 1;
+        const int32 MaxZ = MinZ + CHUNK_SIZE_Z - 1;
+
+        const int32 R0X = FloorDiv(MinX - FEATURE_MAX_SPILL, REGION_VOXELS_X);
+        const int32 R1X = FloorDiv(MaxX + FEATURE_MAX_SPILL, REGION_VOXELS_X);
+        const int32 R0Z = FloorDiv(MinZ - FEATURE_MAX_SPILL, REGION_VOXELS_Z);
+        const int32 R1Z = FloorDiv(MaxZ + FEATURE_MAX_SPILL, REGION_VOXELS_Z);
+
+        // Fixed region order (Z then X) so overlapping features resolve identically in every chunk.
+        for (int32 RZ = R0Z; RZ <= R1Z; ++RZ)
+        {
+            for (int32 RX = R0X; RX <= R1X; ++RX)
+            {
+                const FIntPoint RegionCoord(RX, RZ);
+                TSharedPtr<const FVoxelFeatureRegion> Region = Cache ? Cache->Find(RegionCoord) : nullptr;
+                if (!Region.IsValid())
+                {
+                    Region = BuildRegion(Gen, RegionCoord);
+                    if (Cache) Region = Cache->Add(Region);
+                }
+
+                for (const FVoxelFeature& F : Region->Features)
+                {
+                    if (F.Max.X < MinX || F.Min.X > MaxX || F.Max.Z < MinZ || F.Min.Z > MaxZ) continue;
+
+                    for (const FVoxelFeatureBlock& B : F.Blocks)
+                    {
+                        const int32 LX = B.Pos.X - MinX;
+                        const int32 LZ = B.Pos.Z - MinZ;
+                        if (LX < 0 || LX >= CHUNK_SIZE_X || LZ < 0 || LZ >= CHUNK_SIZE_Z) continue;
+
+                        const int32 Index = IndexFromXYZ(LX, B.Pos.Y, LZ);
+                        if (CanReplace(Chunk.Blocks[Index], B.Replace))
+                        {
+                            Chunk.Blocks[Index] = B.Id;
+                        }
+                    }
+                }
+            }
+        }
+    }
+}
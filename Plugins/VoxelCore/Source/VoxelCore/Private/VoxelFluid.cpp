@@ -0,0 +1,76 @@
+#include "VoxelFluid.h"
+#include "VoxelChunk.h"
+#include "ChunkConfig.h"
+
+namespace
+{
+    // Voxel ids by global coords over the step's chunk set (one-chunk cache)
+    struct FFluidView
+    {
+        const TMap<FChunkKey, TArray<uint8>>& Chunks;
+        FChunkKey CachedKey = FChunkKey(MAX_int32, MAX_int32);
+        const TArray<uint8>* Cached = nullptr;
+
+        explicit FFluidView(const TMap<FChunkKey, TArray<uint8>>& InChunks) : Chunks(InChunks) {}
+
+        uint8 Get(const FIntVector& G)
+        {
+            if (G.Y >= CHUNK_SIZE_Y) return (uint8)EBlockId::Air;
+            if (G.Y < 0) return (uint8)EBlockId::Stone;
+
+            int32 LX = 0, LZ = 0;
+            const FChunkKey Key = GlobalToChunkLocal(G.X, G.Z, LX, LZ);
+            if (!(Key == CachedKey))
+            {
+                CachedKey = Key;
+                Cached = Chunks.Find(Key);
+            }
+
+            // Unloaded ground holds water back rather than swallowing it
+            if (!Cached) return (uint8)EBlockId::Stone;
+            return (*Cached)[IndexFromXYZ(LX, G.Y, LZ)];
+        }
+    };
+
+    const FIntVector Sides[4] = { FIntVector(1, 0, 0), FIntVector(-1, 0, 0), FIntVector(0, 0, 1), FIntVector(0, 0, -1) };
+    const FIntVector Up(0, 1, 0);
+}
+
+namespace VoxelFluid
+{
+    void Run(FStep& Step)
+    {
+        FFluidView View(Step.Chunks);
+        Step.Writes.Reset();
+
+        for (const FIntVector& G : Step.Cells)
+        {
+            const uint8 Cur = View.Get(G);
+            if (!IsReplaceable(Cur)) continue;
+
+            uint8 Want = 0;
+            if (IsFluid(View.Get(G + Up)))
+            {
+                Want = SourceLevel - 1;
+            }
+            else
+            {
+                for (const FIntVector& S : Sides)
+                {
+                    const uint8 Level = LevelOf(View.Get(G + S));
+                    if (Level <= Want + 1) continue;
+
+                    // Water over a drop falls instead of spreading
+                    if (IsReplaceable(View.Get(G + S - Up))) continue;
+                    Want = Level - 1;
+                }
+            }
+
+            const uint8 NewId = FlowId(Want);
+            if (NewId != Cur)
+            {
+                Step.Writes.Add({ G, Cur, NewId });
+            }
+        }
+    }
+}
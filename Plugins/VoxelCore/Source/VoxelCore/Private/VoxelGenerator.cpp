@@ -1,6 +1,7 @@
 #include "VoxelGenerator.h"
 #include "ChunkConfig.h"
 #include "VoxelTypes.h"
+#include "VoxelFeatures.h"
 
 FVoxelGenerator::FVoxelGenerator(int32 InSeed)
     : Seed(InSeed)
@@ -13,6 +14,25 @@ FVoxelGenerator::FVoxelGenerator(int32 InSeed)
     NoiseHeight.SetFrequency(NoiseFrequency);
 }
 
+FVoxelGenerator::FVoxelGenerator(const FVoxelGeneratorConfig& Config)
+    : FVoxelGenerator(Config.Seed)
+{
+    // Same path as the setters so a config and a tweaked generator always agree
+    SetHeightScale(Config.HeightScale);
+    SetHeightOffset(Config.HeightOffset);
+    SetNoiseFrequency(Config.NoiseFrequency);
+}
+
+FVoxelGeneratorConfig FVoxelGenerator::GetConfig() const
+{
+    FVoxelGeneratorConfig Config;
+    Config.Seed = Seed;
+    Config.HeightScale = HeightScale;
+    Config.HeightOffset = HeightOffset;
+    Config.NoiseFrequency = NoiseFrequency;
+    return Config;
+}
+
 void FVoxelGenerator::GenerateBaseChunk(const FChunkKey& Key, FVoxelChunkData& OutChunk)
 {
     OutChunk.Key = Key;
@@ -31,13 +51,8 @@ void FVoxelGenerator::GenerateBaseChunk(const FChunkKey& Key, FVoxelChunkData& O
             int32 WorldX = Key.X * CHUNK_SIZE_X + LocalX;
             int32 WorldZ = Key.Z * CHUNK_SIZE_Z + LocalZ;
 
-            // Noise input (scaled floats)
-            float NX = static_cast<float>(WorldX) * NoiseFrequency;
-            float NZ = static_cast<float>(WorldZ) * NoiseFrequency;
-            float NoiseVal = NoiseHeight.GetNoise(NX, NZ);
-
             // Map noise to usable chunk height
-            int32 ColumnTopY = WorldHeightFromNoise(NoiseVal);
+            int32 ColumnTopY = GetColumnTopY(WorldX, WorldZ);
 
             for (int32 LocalY = 0; LocalY < CHUNK_SIZE_Y; ++LocalY)
             {
@@ -67,3 +82,17 @@ void FVoxelGenerator::GenerateBaseChunk(const FChunkKey& Key, FVoxelChunkData& O
         }
     }
 }
+
+int32 FVoxelGenerator::GetColumnTopY(int32 WorldX, int32 WorldZ) const
+{
+    // Noise input (scaled floats)
+    const float NX = static_cast<float>(WorldX) * NoiseFrequency;
+    const float NZ = static_cast<float>(WorldZ) * NoiseFrequency;
+    return WorldHeightFromNoise(NoiseHeight.GetNoise(NX, NZ));
+}
+
+void FVoxelGenerator::GenerateChunk(const FChunkKey& Key, FVoxelChunkData& OutChunk)
+{
+    GenerateBaseChunk(Key, OutChunk);
+    VoxelFeatures::DecorateChunk(*this, FeatureCache.Get(), Key, OutChunk);
+}
@@ -0,0 +1,373 @@
+#include "VoxelLight.h"
+#include "VoxelChunk.h"
+#include "VoxelMesher.h"          // FVoxelChunkNeighbors
+#include "VoxelBlockRegistry.h"
+#include "ChunkConfig.h"
+
+namespace
+{
+    constexpr int32 SkyShift = 4;
+    constexpr int32 BlockShift = 0;
+
+    // Voxel-space steps (X, Y up, Z); Down is the one sky light keeps full strength along
+    const FIntVector Dirs[6] =
+    {
+        FIntVector(1, 0, 0), FIntVector(-1, 0, 0), FIntVector(0, 0, 1), FIntVector(0, 0, -1), FIntVector(0, 1, 0), FIntVector(0, -1, 0),
+    };
+    constexpr int32 Up = 4;
+    constexpr int32 Down = 5;
+
+    FORCEINLINE bool PassesLight(uint8 Id) { return VoxelBlocks::Get(Id).bTransparent; }
+    FORCEINLINE uint8 Channel(uint8 Light, int32 Shift) { return (Light >> Shift) & 0x0F; }
+
+    // Cells by global voxel coords over whatever chunks Resolve hands out (one-chunk cache)
+    struct FLightWorld
+    {
+        VoxelLight::FResolve Resolve;
+        VoxelLight::FChanges* Changes = nullptr;
+        FChunkKey CachedKey = FChunkKey(MAX_int32, MAX_int32);
+        FVoxelChunkData* Cached = nullptr;
+
+        FLightWorld(VoxelLight::FResolve InResolve, VoxelLight::FChanges* InChanges)
+            : Resolve(InResolve), Changes(InChanges) {}
+
+        FVoxelChunkData* Find(const FIntVector& G, int32& OutIndex)
+        {
+            if (G.Y < 0 || G.Y >= CHUNK_SIZE_Y) return nullptr;
+
+            int32 LX = 0, LZ = 0;
+            const FChunkKey Key = GlobalToChunkLocal(G.X, G.Z, LX, LZ);
+            if (!(Key == CachedKey))
+            {
+                CachedKey = Key;
+                Cached = Resolve(Key);
+                if (Cached && Cached->Light.Num() != CHUNK_VOLUME) Cached = nullptr;
+            }
+            OutIndex = IndexFromXYZ(LX, G.Y, LZ);
+            return Cached;
+        }
+
+        void Set(FVoxelChunkData& C, int32 Index, int32 Shift, uint8 Level)
+        {
+            C.Light[Index] = (uint8)((C.Light[Index] & ~(0x0F << Shift)) | (Level << Shift));
+            if (!Changes) return;
+
+            FIntVector P;
+            XYZFromIndex(Index, P.X, P.Y, P.Z);
+            if (TPair<FIntVector, FIntVector>* B = Changes->Find(C.Key))
+            {
+                B->Key = B->Key.ComponentMin(P);
+                B->Value = B->Value.ComponentMax(P);
+            }
+            else
+            {
+                Changes->Add(C.Key, { P, P });
+            }
+        }
+    };
+
+    // BFS out of every cell in Queue (consumed)
+    void Spread(FLightWorld& W, TArray<FIntVector>& Queue, int32 Shift)
+    {
+        for (int32 Head = 0; Head < Queue.Num(); ++Head)
+        {
+            const FIntVector G = Queue[Head];
+            int32 I;
+            const FVoxelChunkData* C = W.Find(G, I);
+            if (!C) continue;
+
+            const uint8 Level = Channel(C->Light[I], Shift);
+            if (Level <= 1) continue;
+
+            for (int32 D = 0; D < 6; ++D)
+            {
+                const FIntVector N = G + Dirs[D];
+                int32 NI;
+                FVoxelChunkData* NC = W.Find(N, NI);
+                if (!NC) continue;
+
+                const uint8 NId = NC->GetRawAtIndex(NI);
+                if (!PassesLight(NId)) continue;
+
+                const bool bSkyColumn = Shift == SkyShift && D == Down && Level == VoxelLight::MaxLevel && NId == (uint8)EBlockId::Air;
+                const uint8 Target = bSkyColumn ? Level : Level - 1;
+                if (Channel(NC->Light[NI], Shift) >= Target) continue;
+
+                W.Set(*NC, NI, Shift, Target);
+                Queue.Add(N);
+            }
+        }
+        Queue.Reset();
+    }
+
+    // Whether a cell's light still has a source: its own emission, open sky, or a brighter neighbour.
+    // Unloaded neighbours can't be checked and count as a source.
+    bool IsBacked(FLightWorld& W, const FIntVector& G, int32 Shift)
+    {
+        int32 I;
+        const FVoxelChunkData* C = W.Find(G, I);
+        if (!C) return true;
+
+        const uint8 Level = Channel(C->Light[I], Shift);
+        if (Level == 0) return true;
+
+        const uint8 Id = C->GetRawAtIndex(I);
+        if (Shift == BlockShift && VoxelBlocks::Get(Id).Emission >= Level) return true;
+        if (Shift == SkyShift && Level == VoxelLight::MaxLevel && G.Y == CHUNK_SIZE_Y - 1) return true;
+
+        for (int32 D = 0; D < 6; ++D)
+        {
+            const FIntVector N = G + Dirs[D];
+            if (N.Y < 0 || N.Y >= CHUNK_SIZE_Y) continue;
+
+            int32 NI;
+            const FVoxelChunkData* NC = W.Find(N, NI);
+            if (!NC) return true;
+
+            const uint8 NLevel = Channel(NC->Light[NI], Shift);
+            if (NLevel > Level) return true;
+            if (Shift == SkyShift && D == Up && NLevel == VoxelLight::MaxLevel && Level == VoxelLight::MaxLevel && Id == (uint8)EBlockId::Air) return true;
+        }
+        return false;
+    }
+
+    // Clears light that was fed by the removed cells; anything lit from elsewhere goes to Refill
+    void Unspread(FLightWorld& W, TArray<TPair<FIntVector, uint8>>& Removed, TArray<FIntVector>& Refill, int32 Shift)
+    {
+        for (int32 Head = 0; Head < Removed.Num(); ++Head)
+        {
+            const FIntVector G = Removed[Head].Key;
+            const uint8 Level = Removed[Head].Value;
+
+            for (int32 D = 0; D < 6; ++D)
+            {
+                const FIntVector N = G + Dirs[D];
+                int32 NI;
+                FVoxelChunkData* NC = W.Find(N, NI);
+                if (!NC) continue;
+
+                const uint8 NLevel = Channel(NC->Light[NI], Shift);
+                if (NLevel == 0) continue;
+
+                const bool bFed = NLevel < Level || (Shift == SkyShift && D == Down && Level == VoxelLight::MaxLevel && NLevel == VoxelLight::MaxLevel);
+                if (!bFed)
+                {
+                    Refill.Add(N);
+                    continue;
+                }
+
+                // Emitters keep their own light and shine back into the cleared area
+                const uint8 Emit = Shift == BlockShift ? VoxelBlocks::Get(NC->GetRawAtIndex(NI)).Emission : 0;
+                W.Set(*NC, NI, Shift, Emit);
+                Removed.Add({ N, NLevel });
+                if (Emit > 0) Refill.Add(N);
+            }
+        }
+        Removed.Reset();
+    }
+}
+
+namespace VoxelLight
+{
+    void ComputeChunk(FVoxelChunkData& Data, const FVoxelChunkNeighbors* Neighbors)
+    {
+        Data.Light.Reset();
+        Data.Light.SetNumZeroed(CHUNK_VOLUME);
+
+        static thread_local TArray<uint8> Dense;
+        Data.GetFlattened(Dense);
+
+        const int32 BaseX = Data.Key.X * CHUNK_SIZE_X;
+        const int32 BaseZ = Data.Key.Z * CHUNK_SIZE_Z;
+        static thread_local TArray<FIntVector> SkyQueue;
+        static thread_local TArray<FIntVector> BlockQueue;
+        SkyQueue.Reset();
+        BlockQueue.Reset();
+
+        for (int32 Z = 0; Z < CHUNK_SIZE_Z; ++Z)
+        {
+            for (int32 X = 0; X < CHUNK_SIZE_X; ++X)
+            {
+                // Open sky straight down to the first block
+                for (int32 Y = CHUNK_SIZE_Y - 1; Y >= 0 && Dense[IndexFromXYZ(X, Y, Z)] == (uint8)EBlockId::Air; --Y)
+                {
+                    Data.Light[IndexFromXYZ(X, Y, Z)] = FullSky;
+                    SkyQueue.Add(FIntVector(BaseX + X, Y, BaseZ + Z));
+                }
+            }
+        }
+
+        for (int32 I = 0; I < CHUNK_VOLUME; ++I)
+        {
+            const uint8 Emit = VoxelBlocks::Get(Dense[I]).Emission;
+            if (Emit == 0) continue;
+
+            Data.Light[I] |= Emit;
+            int32 X, Y, Z;
+            XYZFromIndex(I, X, Y, Z);
+            BlockQueue.Add(FIntVector(BaseX + X, Y, BaseZ + Z));
+        }
+
+        // Light already present across the four side borders flows in one step weaker
+        if (Neighbors)
+        {
+            for (int32 Side = 0; Side < 4; ++Side)
+            {
+                const int32 DX = Dirs[Side].X, DZ = Dirs[Side].Z;
+                const TArray<uint8>& NLight = Neighbors->Light[FVoxelChunkNeighbors::Slot(DX, DZ)];
+                if (NLight.Num() == 0) continue;
+
+                for (int32 T = 0, Len = DX != 0 ? CHUNK_SIZE_Z : CHUNK_SIZE_X; T < Len; ++T)
+                {
+                    // Own border cell and the neighbour's cell facing it
+                    const int32 X = DX > 0 ? CHUNK_SIZE_X - 1 : (DX < 0 ? 0 : T);
+                    const int32 Z = DZ > 0 ? CHUNK_SIZE_Z - 1 : (DZ < 0 ? 0 : T);
+                    const int32 NX = X - DX * (CHUNK_SIZE_X - 1);
+                    const int32 NZ = Z - DZ * (CHUNK_SIZE_Z - 1);
+                    for (int32 Y = 0; Y < CHUNK_SIZE_Y; ++Y)
+                    {
+                        const int32 I = IndexFromXYZ(X, Y, Z);
+                        if (!PassesLight(Dense[I])) continue;
+
+                        const uint8 In = NLight[FVoxelChunkNeighbors::RingIndex(DX, DZ, NX, Y, NZ)];
+                        const uint8 S = Sky(In) > 1 ? Sky(In) - 1 : 0;
+                        const uint8 B = Block(In) > 1 ? Block(In) - 1 : 0;
+                        const FIntVector G(BaseX + X, Y, BaseZ + Z);
+                        if (S > Sky(Data.Light[I]))
+                        {
+                            Data.Light[I] = (uint8)((S << 4) | Block(Data.Light[I]));
+                            SkyQueue.Add(G);
+                        }
+                        if (B > Block(Data.Light[I]))
+                        {
+                            Data.Light[I] = (uint8)((Data.Light[I] & 0xF0) | B);
+                            BlockQueue.Add(G);
+                        }
+                    }
+                }
+            }
+        }
+
+        // Confined to this chunk: writes into the neighbours happen in StitchBorders
+        auto Self = [&Data](const FChunkKey& K) { return K == Data.Key ? &Data : nullptr; };
+        FLightWorld W(Self, nullptr);
+        Spread(W, SkyQueue, SkyShift);
+        Spread(W, BlockQueue, BlockShift);
+    }
+
+    void UpdateAfterEdits(TConstArrayView<FIntVector> Cells, FResolve Resolve, FChanges& OutChanges)
+    {
+        FLightWorld W(Resolve, &OutChanges);
+        TArray<TPair<FIntVector, uint8>> Removed;
+        TArray<FIntVector> Refill;
+
+        for (const int32 Shift : { SkyShift, BlockShift })
+        {
+            for (const FIntVector& G : Cells)
+            {
+                int32 I;
+                FVoxelChunkData* C = W.Find(G, I);
+                if (!C) continue;
+
+                const uint8 Id = C->GetRawAtIndex(I);
+                const bool bOpen = PassesLight(Id);
+                uint8 Seed = 0;
+                if (Shift == BlockShift) Seed = VoxelBlocks::Get(Id).Emission;
+                else if (bOpen && G.Y == CHUNK_SIZE_Y - 1) Seed = MaxLevel; // under open sky
+
+                const uint8 Old = Channel(C->Light[I], Shift);
+                W.Set(*C, I, Shift, Seed);
+                if (Old > 0) Removed.Add({ G, Old });
+                if (Seed > 0) Refill.Add(G);
+
+                // An opened cell pulls light in from around it
+                if (bOpen)
+                {
+                    for (const FIntVector& D : Dirs) Refill.Add(G + D);
+                }
+            }
+
+            Unspread(W, Removed, Refill, Shift);
+            Spread(W, Refill, Shift);
+        }
+    }
+
+    void StitchBorders(const FChunkKey& Key, FResolve Resolve, FChanges& OutChanges)
+    {
+        FVoxelChunkData* Self = Resolve(Key);
+        if (!Self || Self->Light.Num() != CHUNK_VOLUME) return;
+
+        FLightWorld W(Resolve, &OutChanges);
+        const int32 BaseX = Key.X * CHUNK_SIZE_X;
+        const int32 BaseZ = Key.Z * CHUNK_SIZE_Z;
+
+        // Calls Fn(own cell, neighbour cell facing it) for every border pair with a lit, loaded neighbour chunk
+        auto ForEachBorderPair = [&](auto&& Fn)
+        {
+            for (int32 Side = 0; Side < 4; ++Side)
+            {
+                const int32 DX = Dirs[Side].X, DZ = Dirs[Side].Z;
+                const FVoxelChunkData* N = Resolve(FChunkKey(Key.X + DX, Key.Z + DZ));
+                if (!N || N->Light.Num() != CHUNK_VOLUME) continue;
+
+                for (int32 T = 0, Len = DX != 0 ? CHUNK_SIZE_Z : CHUNK_SIZE_X; T < Len; ++T)
+                {
+                    const int32 X = DX > 0 ? CHUNK_SIZE_X - 1 : (DX < 0 ? 0 : T);
+                    const int32 Z = DZ > 0 ? CHUNK_SIZE_Z - 1 : (DZ < 0 ? 0 : T);
+                    for (int32 Y = 0; Y < CHUNK_SIZE_Y; ++Y)
+                    {
+                        const FIntVector GA(BaseX + X, Y, BaseZ + Z);
+                        Fn(GA, GA + FIntVector(DX, 0, DZ));
+                    }
+                }
+            }
+        };
+
+        // Either side may hold light the other fed it before it was reloaded or edited while
+        // unloaded; clear whatever no longer has a source and let the refill put back what does
+        for (const int32 Shift : { SkyShift, BlockShift })
+        {
+            TArray<FIntVector> Stale;
+            ForEachBorderPair([&](const FIntVector& GA, const FIntVector& GB)
+            {
+                if (!IsBacked(W, GA, Shift)) Stale.Add(GA);
+                if (!IsBacked(W, GB, Shift)) Stale.Add(GB);
+            });
+            if (Stale.Num() == 0) continue;
+
+            TArray<TPair<FIntVector, uint8>> Removed;
+            TArray<FIntVector> Refill;
+            for (const FIntVector& G : Stale)
+            {
+                int32 I;
+                FVoxelChunkData* C = W.Find(G, I);
+                const uint8 Old = Channel(C->Light[I], Shift);
+                if (Old == 0) continue;
+
+                const uint8 Emit = Shift == BlockShift ? VoxelBlocks::Get(C->GetRawAtIndex(I)).Emission : 0;
+                W.Set(*C, I, Shift, Emit);
+                Removed.Add({ G, Old });
+                if (Emit > 0) Refill.Add(G);
+            }
+            Unspread(W, Removed, Refill, Shift);
+            Spread(W, Refill, Shift);
+        }
+
+        // Only pairs where one side is brighter by more than a step have anything to give
+        TArray<FIntVector> SkyQueue;
+        TArray<FIntVector> BlockQueue;
+        ForEachBorderPair([&](const FIntVector& GA, const FIntVector& GB)
+        {
+            int32 IA, IB;
+            const uint8 A = W.Find(GA, IA)->Light[IA];
+            const uint8 B = W.Find(GB, IB)->Light[IB];
+            if (Sky(A) > Sky(B) + 1) SkyQueue.Add(GA);
+            else if (Sky(B) > Sky(A) + 1) SkyQueue.Add(GB);
+            if (Block(A) > Block(B) + 1) BlockQueue.Add(GA);
+            else if (Block(B) > Block(A) + 1) BlockQueue.Add(GB);
+        });
+
+        Spread(W, SkyQueue, SkyShift);
+        Spread(W, BlockQueue, BlockShift);
+    }
+}
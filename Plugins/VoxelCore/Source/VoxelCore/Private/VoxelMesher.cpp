@@ -1,139 +1,559 @@
 #include "VoxelMesher.h"
 #include "ChunkConfig.h"
 #include "ChunkHelpers.h"
+#include "VoxelLight.h"
 #include "Math/UnrealMathUtility.h"
-#include "ProceduralMeshComponent.h" // for FProcMeshTangent
-
-void FVoxelMesher_Naive::BuildMesh(const FVoxelChunkData& Chunk, float BlockSize,
-    TArray<FVector>& OutVertices,
-    TArray<int32>& OutTriangles,
-    TArray<FVector>& OutNormals,
-    TArray<FVector2D>& OutUVs,
-    TArray<FLinearColor>& OutColors,
-    TArray<FProcMeshTangent>& OutTangents)
+#include "Algo/Sort.h"
+
+namespace
 {
-    OutVertices.Reset();
-    OutTriangles.Reset();
-    OutNormals.Reset();
-    OutUVs.Reset();
-    OutColors.Reset();
-    OutTangents.Reset();
+    // Quad corners per face as unit-cube offsets in world axis order (X, Y, Z).
+    // Winding matches the original per-face PushFace calls.
+    constexpr float FaceCorners[6][4][3] =
+    {
+        { {1,0,0}, {1,1,0}, {1,1,1}, {1,0,1} }, // +X
+        { {0,1,0}, {0,0,0}, {0,0,1}, {0,1,1} }, // -X
+        { {1,1,0}, {0,1,0}, {0,1,1}, {1,1,1} }, // +Y (north)
+        { {0,0,0}, {1,0,0}, {1,0,1}, {0,0,1} }, // -Y (south)
+        { {0,0,1}, {1,0,1}, {1,1,1}, {0,1,1} }, // +Z (top)
+        { {0,1,0}, {1,1,0}, {1,0,0}, {0,0,0} }, // -Z (bottom)
+    };
 
-    const float Half = BlockSize * 0.5f;
+    // Voxel-space neighbor offsets (X, Y up, Z) for the same faces
+    constexpr int8 FaceNeighbor[6][3] =
+    {
+        { 1, 0, 0 }, { -1, 0, 0 }, { 0, 0, 1 }, { 0, 0, -1 }, { 0, 1, 0 }, { 0, -1, 0 },
+    };
 
-    for (int32 X = 0; X < CHUNK_SIZE_X; ++X)
+    // Per corner: pick U0/U1 and V0/V1 of the tile rect. Top faces are flipped so they read upright.
+    constexpr uint8 FaceUVCorner[6][4][2] =
     {
-        for (int32 Z = 0; Z < CHUNK_SIZE_Z; ++Z)
+        { {0,0}, {1,0}, {1,1}, {0,1} },
+        { {0,0}, {1,0}, {1,1}, {0,1} },
+        { {0,0}, {1,0}, {1,1}, {0,1} },
+        { {0,0}, {1,0}, {1,1}, {0,1} },
+        { {0,1}, {1,1}, {1,0}, {0,0} }, // top
+        { {0,0}, {1,0}, {1,1}, {0,1} },
+    };
+
+    // Packed once at startup: normal (W = +1 binormal sign) and tangent per face.
+    // Tangent is Up x Normal on the sides and +X on top/bottom where that cross product vanishes.
+    const FPackedNormal FaceTangentZ[6] =
+    {
+        FPackedNormal(FVector4f(1, 0, 0, 1)), FPackedNormal(FVector4f(-1, 0, 0, 1)),
+        FPackedNormal(FVector4f(0, 1, 0, 1)), FPackedNormal(FVector4f(0, -1, 0, 1)),
+        FPackedNormal(FVector4f(0, 0, 1, 1)), FPackedNormal(FVector4f(0, 0, -1, 1)),
+    };
+
+    const FPackedNormal FaceTangentX[6] =
+    {
+        FPackedNormal(FVector3f(0, 1, 0)), FPackedNormal(FVector3f(0, -1, 0)),
+        FPackedNormal(FVector3f(-1, 0, 0)), FPackedNormal(FVector3f(1, 0, 0)),
+        FPackedNormal(FVector3f(1, 0, 0)), FPackedNormal(FVector3f(1, 0, 0)),
+    };
+
+    // AO samples per face corner, as voxel offsets (X, Y up, Z) from the solid voxel:
+    // the two edge neighbours and the diagonal, all in the layer in front of the face.
+    struct FAOOffsets
+    {
+        int8 Off[6][4][3][3]; // [face][corner][side1, side2, diagonal][x, y, z]
+    };
+
+    constexpr FAOOffsets BuildAOOffsets()
+    {
+        FAOOffsets T{};
+        for (int32 F = 0; F < 6; ++F)
         {
-            for (int32 Y = 0; Y < CHUNK_SIZE_Y; ++Y)
+            for (int32 C = 0; C < 4; ++C)
             {
-                EBlockId Id = Chunk.GetBlockAt(X, Y, Z);
-                if (Id == EBlockId::Air) continue;
+                // Corner direction per voxel axis (world corner order is X, voxel Z, voxel Y)
+                const int8 Dir[3] =
+                {
+                    (int8)(2 * (int32)FaceCorners[F][C][0] - 1),
+                    (int8)(2 * (int32)FaceCorners[F][C][2] - 1),
+                    (int8)(2 * (int32)FaceCorners[F][C][1] - 1),
+                };
 
-                const float WorldX = static_cast<float>(X) * BlockSize;
-                const float WorldY = static_cast<float>(Z) * BlockSize;
-                const float WorldZ = static_cast<float>(Y) * BlockSize;
+                int32 Side = 0;
+                for (int32 A = 0; A < 3; ++A)
+                {
+                    T.Off[F][C][2][A] = FaceNeighbor[F][A];
+                }
+                for (int32 A = 0; A < 3; ++A)
+                {
+                    if (FaceNeighbor[F][A] != 0) continue; // normal axis
+                    for (int32 K = 0; K < 3; ++K)
+                    {
+                        T.Off[F][C][Side][K] = FaceNeighbor[F][K];
+                    }
+                    T.Off[F][C][Side][A] = Dir[A];
+                    T.Off[F][C][2][A] = Dir[A];
+                    ++Side;
+                }
+            }
+        }
+        return T;
+    }
 
-                const FVector Min(WorldX - Half, WorldY - Half, WorldZ - Half);
-                const FVector Max(WorldX + Half, WorldY + Half, WorldZ + Half);
+    constexpr FAOOffsets AOOffsets = BuildAOOffsets();
 
-                const FVector
-                    B00(Min.X, Min.Y, Min.Z), B10(Max.X, Min.Y, Min.Z),
-                    B11(Max.X, Max.Y, Min.Z), B01(Min.X, Max.Y, Min.Z),
-                    T00(Min.X, Min.Y, Max.Z), T10(Max.X, Min.Y, Max.Z),
-                    T11(Max.X, Max.Y, Max.Z), T01(Min.X, Max.Y, Max.Z);
+    // Vertex alpha per AO level (0 = both edges + corner blocked)
+    constexpr uint8 AOAlpha[4] = { 102, 153, 204, 255 };
 
-                FVector2D UV0, Tile;
-                GetAtlasUVForBlock(Id, UV0, Tile);
+    // Vertex color scale (x/255) per light level: 80% per level down from full, with a floor
+    // so caves are dark but not black
+    struct FLightCurve
+    {
+        uint8 Scale[VoxelLight::MaxLevel + 1];
+    };
+
+    constexpr FLightCurve BuildLightCurve()
+    {
+        FLightCurve T{};
+        float S = 1.f;
+        for (int32 L = VoxelLight::MaxLevel; L >= 0; --L)
+        {
+            T.Scale[L] = (uint8)((S > 0.06f ? S : 0.06f) * 255.f + 0.5f);
+            S *= 0.8f;
+        }
+        return T;
+    }
 
-                FLinearColor Color = FLinearColor::White;
-                switch (Id)
+    constexpr FLightCurve LightCurve = BuildLightCurve();
+}
+
+void FVoxelChunkNeighbors::CopyFrom(int32 DX, int32 DZ, const FVoxelChunkData& Neighbor)
+{
+    const int32 S = Slot(DX, DZ);
+    const int32 Len = Length(DX, DZ);
+    const bool bLit = Neighbor.Light.Num() == CHUNK_VOLUME;
+    Ids[S].SetNumUninitialized(Len * CHUNK_SIZE_Y);
+    Light[S].SetNum(bLit ? Len * CHUNK_SIZE_Y : 0);
+
+    for (int32 T = 0; T < Len; ++T)
+    {
+        // Neighbour-local column facing the chunk
+        const int32 NX = DX > 0 ? 0 : (DX < 0 ? CHUNK_SIZE_X - 1 : T);
+        const int32 NZ = DZ > 0 ? 0 : (DZ < 0 ? CHUNK_SIZE_Z - 1 : T);
+        for (int32 Y = 0; Y < CHUNK_SIZE_Y; ++Y)
+        {
+            const int32 I = IndexFromXYZ(NX, Y, NZ);
+            Ids[S][T + Y * Len] = Neighbor.GetRawAtIndex(I);
+            if (bLit) Light[S][T + Y * Len] = Neighbor.Light[I];
+        }
+    }
+}
+
+void FVoxelMesher_Naive::BuildPackedMesh(const FVoxelChunkData& Chunk, TArray<FVoxelPackedFace>& OutFaces, bool bTwoPass,
+    const FVoxelChunkNeighbors* Neighbors, uint8 SectionMask)
+{
+    constexpr int32 PX = CHUNK_SIZE_X + 2;
+    constexpr int32 PZ = CHUNK_SIZE_Z + 2;
+    constexpr int32 Layer = PX * PZ;
+
+    // Per-worker scratch: same size every job, so it is allocated once per thread
+    static thread_local TArray<uint8> Dense;
+    static thread_local TArray<uint8> Padded;
+    static thread_local TArray<uint8> PaddedLight;
+    Chunk.GetFlattened(Dense);
+    Padded.Reset();
+    Padded.SetNumZeroed(Layer * CHUNK_SIZE_Y);
+
+    // Unlit chunks (and missing neighbours) read as full daylight rather than black
+    const bool bLit = Chunk.Light.Num() == CHUNK_VOLUME;
+    PaddedLight.Reset();
+    PaddedLight.SetNumUninitialized(Layer * CHUNK_SIZE_Y);
+    FMemory::Memset(PaddedLight.GetData(), VoxelLight::FullSky, PaddedLight.Num());
+
+    // Rows the requested sections read: their own plus one above and below
+    if (SectionMask == 0)
+    {
+        OutFaces.Reset();
+        return;
+    }
+    const int32 FirstSection = FMath::CountTrailingZeros((uint32)SectionMask);
+    const int32 LastSection = 31 - FMath::CountLeadingZeros((uint32)SectionMask);
+    const int32 YLo = FMath::Max(0, FirstSection * CHUNK_SECTION_HEIGHT - 1);
+    const int32 YHi = FMath::Min(CHUNK_SIZE_Y - 1, (LastSection + 1) * CHUNK_SECTION_HEIGHT);
+
+    // Interior rows
+    for (int32 Y = YLo; Y <= YHi; ++Y)
+    {
+        for (int32 Z = 0; Z < CHUNK_SIZE_Z; ++Z)
+        {
+            FMemory::Memcpy(&Padded[1 + (Z + 1) * PX + Y * Layer], &Dense[IndexFromXYZ(0, Y, Z)], CHUNK_SIZE_X);
+            if (bLit)
+            {
+                FMemory::Memcpy(&PaddedLight[1 + (Z + 1) * PX + Y * Layer], &Chunk.Light[IndexFromXYZ(0, Y, Z)], CHUNK_SIZE_X);
+            }
+        }
+    }
+
+    // One-voxel ring from the neighbours (edges + corners)
+    if (Neighbors)
+    {
+        for (int32 PZi = 0; PZi < PZ; ++PZi)
+        {
+            for (int32 PXi = 0; PXi < PX; ++PXi)
+            {
+                const int32 LX = PXi - 1;
+                const int32 LZ = PZi - 1;
+                const int32 DX = LX < 0 ? -1 : (LX >= CHUNK_SIZE_X ? 1 : 0);
+                const int32 DZ = LZ < 0 ? -1 : (LZ >= CHUNK_SIZE_Z ? 1 : 0);
+                if (DX == 0 && DZ == 0) continue;
+
+                const int32 S = FVoxelChunkNeighbors::Slot(DX, DZ);
+                if (Neighbors->Ids[S].Num() == 0) continue;
+
+                const int32 NX = LX - DX * CHUNK_SIZE_X;
+                const int32 NZ = LZ - DZ * CHUNK_SIZE_Z;
+                const bool bNeighborLit = Neighbors->Light[S].Num() > 0;
+                for (int32 Y = YLo; Y <= YHi; ++Y)
                 {
-                case EBlockId::Grass: Color = FLinearColor(0.1f, 0.8f, 0.1f); break;
-                case EBlockId::Dirt:  Color = FLinearColor(0.45f, 0.28f, 0.13f); break;
-                case EBlockId::Stone: Color = FLinearColor(0.5f, 0.5f, 0.5f); break;
-                default: break;
+                    const int32 R = FVoxelChunkNeighbors::RingIndex(DX, DZ, NX, Y, NZ);
+                    Padded[PXi + PZi * PX + Y * Layer] = Neighbors->Ids[S][R];
+                    if (bNeighborLit)
+                    {
+                        PaddedLight[PXi + PZi * PX + Y * Layer] = Neighbors->Light[S][R];
+                    }
                 }
+            }
+        }
+    }
+
+    EmitPackedFaces(Padded.GetData(), PaddedLight.GetData(), CHUNK_SIZE_X, CHUNK_SIZE_Y, CHUNK_SIZE_Z, /*Pad=*/1, /*Lod=*/0, SectionMask, OutFaces, bTwoPass);
+}
 
-                auto PushFace = [&](const FVector& A, const FVector& B, const FVector& C, const FVector& D, const FVector& Normal, bool bFlipTopUVs = false)
+void FVoxelMesher_Naive::BuildPackedMeshLod(const FVoxelChunkData& Chunk, int32 Lod, TArray<FVoxelPackedFace>& OutFaces, bool bTwoPass,
+    const FVoxelChunkNeighbors* Neighbors, uint8 SectionMask)
+{
+    Lod = FMath::Clamp(Lod, 0, VOXEL_MAX_LOD);
+    if (Lod == 0)
+    {
+        BuildPackedMesh(Chunk, OutFaces, bTwoPass, Neighbors, SectionMask);
+        return;
+    }
+
+    static thread_local TArray<uint8> Full;
+    Chunk.GetFlattened(Full);
+
+    const int32 S = 1 << Lod;
+    const int32 SX = CHUNK_SIZE_X / S;
+    const int32 SY = CHUNK_SIZE_Y / S;
+    const int32 SZ = CHUNK_SIZE_Z / S;
+    const int32 CellVolume = S * S * S;
+
+    static thread_local TArray<uint8> Cells;
+    Cells.Reset();
+    Cells.SetNumZeroed(SX * SY * SZ);
+
+    for (int32 CY = 0; CY < SY; ++CY)
+    {
+        for (int32 CZ = 0; CZ < SZ; ++CZ)
+        {
+            for (int32 CX = 0; CX < SX; ++CX)
+            {
+                // Majority vote for solidity; the id comes from the topmost solid voxel so
+                // surfaces keep their top material (grass stays grass from afar).
+                int32 Solid = 0;
+                uint8 TopId = 0;
+                for (int32 y = S - 1; y >= 0; --y)
+                {
+                    const int32 Row = (CY * S + y) * CHUNK_SIZE_X * CHUNK_SIZE_Z;
+                    for (int32 z = 0; z < S; ++z)
                     {
-                        const int32 Base = OutVertices.Num();
-
-                        OutVertices.Add(A); // 0
-                        OutVertices.Add(B); // 1
-                        OutVertices.Add(C); // 2
-                        OutVertices.Add(D); // 3
-
-                        // Flipped winding order for outward normals
-                        OutTriangles.Add(Base + 0);
-                        OutTriangles.Add(Base + 2);
-                        OutTriangles.Add(Base + 1);
-                        OutTriangles.Add(Base + 0);
-                        OutTriangles.Add(Base + 3);
-                        OutTriangles.Add(Base + 2);
-
-                        OutNormals.Add(Normal);
-                        OutNormals.Add(Normal);
-                        OutNormals.Add(Normal);
-                        OutNormals.Add(Normal);
-
-                        // UVs
-                        if (!bFlipTopUVs)
+                        const uint8* Src = Full.GetData() + Row + (CZ * S + z) * CHUNK_SIZE_X + CX * S;
+                        for (int32 x = 0; x < S; ++x)
                         {
-                            const FVector2D U00(UV0.X, UV0.Y);
-                            const FVector2D U10(UV0.X + Tile.X, UV0.Y);
-                            const FVector2D U11(UV0.X + Tile.X, UV0.Y + Tile.Y);
-                            const FVector2D U01(UV0.X, UV0.Y + Tile.Y);
-                            OutUVs.Add(U00);
-                            OutUVs.Add(U10);
-                            OutUVs.Add(U11);
-                            OutUVs.Add(U01);
-                        }
-                        else
-                        {
-                            // ? Corrected orientation for grass top
-                            const FVector2D U00(UV0.X, UV0.Y + Tile.Y);
-                            const FVector2D U10(UV0.X + Tile.X, UV0.Y + Tile.Y);
-                            const FVector2D U11(UV0.X + Tile.X, UV0.Y);
-                            const FVector2D U01(UV0.X, UV0.Y);
-                            OutUVs.Add(U00);
-                            OutUVs.Add(U10);
-                            OutUVs.Add(U11);
-                            OutUVs.Add(U01);
+                            if (Src[x] == 0) continue;
+                            ++Solid;
+                            if (TopId == 0) TopId = Src[x];
                         }
+                    }
+                }
 
-                        OutColors.Add(Color);
-                        OutColors.Add(Color);
-                        OutColors.Add(Color);
-                        OutColors.Add(Color);
+                if (Solid * 2 >= CellVolume)
+                {
+                    Cells[CX + CZ * SX + CY * SX * SZ] = TopId;
+                }
+            }
+        }
+    }
 
-                        const FVector TangentDir = FVector::CrossProduct(FVector::UpVector, Normal).GetSafeNormal();
-                        const FProcMeshTangent Tangent(TangentDir, false);
-                        OutTangents.Add(Tangent);
-                        OutTangents.Add(Tangent);
-                        OutTangents.Add(Tangent);
-                        OutTangents.Add(Tangent);
-                    };
+    // Distant meshes are fully lit
+    EmitPackedFaces(Cells.GetData(), nullptr, SX, SY, SZ, /*Pad=*/0, Lod, SectionMask, OutFaces, bTwoPass);
+}
 
-                auto IsAir = [&](int32 NX, int32 NY, int32 NZ)
+void FVoxelMesher_Naive::EmitPackedFaces(const uint8* Grid, const uint8* LightGrid, int32 SX, int32 SY, int32 SZ, int32 Pad, int32 Lod, uint8 SectionMask,
+    TArray<FVoxelPackedFace>& OutFaces, bool bTwoPass)
+{
+    const int32 CellsPerSection = CHUNK_SECTION_HEIGHT >> Lod;
+
+    const int32 GX = SX + 2 * Pad;
+    const int32 GZ = SZ + 2 * Pad;
+    auto At = [&](int32 X, int32 Y, int32 Z) -> uint8
+        {
+            return Grid[(X + Pad) + (Z + Pad) * GX + Y * GX * GZ];
+        };
+
+    // Outside the chunk counts as air, so every chunk closes its own border. At LOD
+    // transitions those border walls double as skirts and hide cracks between resolutions;
+    // there is no other seam handling (no vertex stitching or transition cells).
+    auto NeighborId = [&](int32 NX, int32 NY, int32 NZ) -> uint8
+        {
+            if (NX < 0 || NX >= SX ||
+                NY < 0 || NY >= SY ||
+                NZ < 0 || NZ >= SZ) return (uint8)EBlockId::Air;
+            return At(NX, NY, NZ);
+        };
+
+    // Same, but reading into the padding ring. Translucent faces use it so water spanning two
+    // chunks gets no wall at the seam (seen through the surface, skirts would show).
+    auto PaddedId = [&](int32 NX, int32 NY, int32 NZ) -> uint8
+        {
+            if (NX < -Pad || NX >= SX + Pad ||
+                NY < 0 || NY >= SY ||
+                NZ < -Pad || NZ >= SZ + Pad) return (uint8)EBlockId::Air;
+            return At(NX, NY, NZ);
+        };
+
+    // AO occluders may come from the padding ring; beyond it (or above/below the world) is open
+    auto Occludes = [&](int32 X, int32 Y, int32 Z) -> int32
+        {
+            return VoxelBlocks::Get(PaddedId(X, Y, Z)).bTransparent ? 0 : 1;
+        };
+
+    auto FaceAO = [&](int32 X, int32 Y, int32 Z, int32 F) -> uint8
+        {
+            uint8 Packed = 0;
+            for (int32 C = 0; C < 4; ++C)
+            {
+                const int8 (&O)[3][3] = AOOffsets.Off[F][C];
+                const int32 S1 = Occludes(X + O[0][0], Y + O[0][1], Z + O[0][2]);
+                const int32 S2 = Occludes(X + O[1][0], Y + O[1][1], Z + O[1][2]);
+                const int32 D = Occludes(X + O[2][0], Y + O[2][1], Z + O[2][2]);
+                const int32 Level = (S1 && S2) ? 0 : 3 - (S1 + S2 + D);
+                Packed |= (uint8)(Level << (C * 2));
+            }
+            return Packed;
+        };
+
+    // Brightness of a cell; open sky above the world and beyond the padding, dark below it
+    auto LightAt = [&](int32 X, int32 Y, int32 Z) -> int32
+        {
+            if (Y < 0) return 0;
+            if (!LightGrid || Y >= SY || X < -Pad || X >= SX + Pad || Z < -Pad || Z >= SZ + Pad) return VoxelLight::MaxLevel;
+            return VoxelLight::Level(LightGrid[(X + Pad) + (Z + Pad) * GX + Y * GX * GZ]);
+        };
+
+    // Smooth light per corner: the cell in front of the face averaged with the open AO samples
+    auto FaceLight = [&](int32 X, int32 Y, int32 Z, int32 F, uint8 (&Out)[2])
+        {
+            if (!LightGrid)
+            {
+                Out[0] = Out[1] = 0xFF;
+                return;
+            }
+
+            Out[0] = Out[1] = 0;
+
+            const int32 Front = LightAt(X + FaceNeighbor[F][0], Y + FaceNeighbor[F][1], Z + FaceNeighbor[F][2]);
+            for (int32 C = 0; C < 4; ++C)
+            {
+                const int8 (&O)[3][3] = AOOffsets.Off[F][C];
+                int32 Sum = Front;
+                int32 Num = 1;
+                for (int32 S = 0; S < 3; ++S)
+                {
+                    if (Occludes(X + O[S][0], Y + O[S][1], Z + O[S][2])) continue;
+                    Sum += LightAt(X + O[S][0], Y + O[S][1], Z + O[S][2]);
+                    ++Num;
+                }
+                Out[C >> 1] |= (uint8)(((Sum + Num / 2) / Num) << ((C & 1) * 4));
+            }
+        };
+
+    auto ForEachVisibleFace = [&](auto&& Visit)
+        {
+            for (int32 Section = 0; Section < CHUNK_NUM_SECTIONS; ++Section)
+            {
+                if ((SectionMask & (1u << Section)) == 0) continue;
+                const int32 Y0 = Section * CellsPerSection;
+                for (int32 X = 0; X < SX; ++X)
+                {
+                    for (int32 Z = 0; Z < SZ; ++Z)
                     {
-                        if (NX < 0 || NX >= CHUNK_SIZE_X ||
-                            NY < 0 || NY >= CHUNK_SIZE_Y ||
-                            NZ < 0 || NZ >= CHUNK_SIZE_Z) return true;
-                        return Chunk.GetBlockAt(NX, NY, NZ) == EBlockId::Air;
-                    };
-
-                if (IsAir(X + 1, Y, Z)) PushFace(B10, B11, T11, T10, FVector(1, 0, 0));    // +X
-                if (IsAir(X - 1, Y, Z)) PushFace(B01, B00, T00, T01, FVector(-1, 0, 0));   // -X
-                if (IsAir(X, Y, Z + 1)) PushFace(B11, B01, T01, T11, FVector(0, 1, 0));    // +Y (north)
-                if (IsAir(X, Y, Z - 1)) PushFace(B00, B10, T10, T00, FVector(0, -1, 0));   // -Y (south)
-                if (IsAir(X, Y + 1, Z)) PushFace(T00, T10, T11, T01, FVector(0, 0, 1), true); // +Z (top, flip UVs)
-                if (IsAir(X, Y - 1, Z)) PushFace(B01, B11, B10, B00, FVector(0, 0, -1));   // -Z (bottom)
+                        for (int32 Y = Y0; Y < Y0 + CellsPerSection; ++Y)
+                        {
+                            const uint8 Raw = At(X, Y, Z);
+                            if (Raw == (uint8)EBlockId::Air) continue;
+
+                            const FVoxelBlockDef& Def = VoxelBlocks::Get(Raw);
+                            const bool bTranslucent = Def.Layer == EVoxelRenderLayer::Translucent;
+                            for (int32 F = 0; F < (int32)EVoxelFace::Count; ++F)
+                            {
+                                const int32 NX = X + FaceNeighbor[F][0];
+                                const int32 NY = Y + FaceNeighbor[F][1];
+                                const int32 NZ = Z + FaceNeighbor[F][2];
+                                const uint8 N = bTranslucent ? PaddedId(NX, NY, NZ) : NeighborId(NX, NY, NZ);
+                                if (!VoxelBlocks::IsFaceVisible(Raw, N)) continue;
+                                Visit(X, Y, Z, F, Raw, Def);
+                            }
+                        }
+                    }
+                }
             }
+        };
+
+    // Optional count pass so the output is reserved exactly once
+    int32 Count = 0;
+    if (bTwoPass)
+    {
+        ForEachVisibleFace([&](int32, int32, int32, int32, uint8, const FVoxelBlockDef&) { ++Count; });
+    }
+    OutFaces.Reset(Count);
+
+    ForEachVisibleFace([&](int32 X, int32 Y, int32 Z, int32 F, uint8 Raw, const FVoxelBlockDef& Def)
+        {
+            FVoxelPackedFace& Face = OutFaces.AddDefaulted_GetRef();
+            Face.X = (uint8)X;
+            Face.Y = (uint8)Y;
+            Face.Z = (uint8)Z;
+            Face.Face = (uint8)F;
+            Face.BlockId = Raw;
+            Face.Tile = Def.FaceTile[F];
+            Face.AO = FaceAO(X, Y, Z, F);
+            FaceLight(X, Y, Z, F, Face.Light);
+        });
+
+    // Sections are already emitted in order; group layers within them (stable counting sort)
+    // so each mesh group is one contiguous range
+    int32 Counts[VOXEL_NUM_MESH_GROUPS];
+    CountGroups(OutFaces, Lod, Counts);
+
+    int32 Next[VOXEL_NUM_MESH_GROUPS] = { 0 };
+    for (int32 G = 1; G < VOXEL_NUM_MESH_GROUPS; ++G)
+    {
+        Next[G] = Next[G - 1] + Counts[G - 1];
+    }
+
+    static thread_local TArray<FVoxelPackedFace> Grouped;
+    Grouped.SetNumUninitialized(OutFaces.Num(), VOXEL_NO_SHRINK);
+    for (const FVoxelPackedFace& Face : OutFaces)
+    {
+        Grouped[Next[VoxelMeshGroup((Face.Y << Lod) / CHUNK_SECTION_HEIGHT, (int32)VoxelBlocks::Get(Face.BlockId).Layer)]++] = Face;
+    }
+    Swap(OutFaces, Grouped);
+}
+
+void FVoxelMesher_Naive::CountGroups(TConstArrayView<FVoxelPackedFace> Faces, int32 Lod, int32 (&OutCounts)[VOXEL_NUM_MESH_GROUPS])
+{
+    for (int32& C : OutCounts) C = 0;
+    for (const FVoxelPackedFace& Face : Faces)
+    {
+        ++OutCounts[VoxelMeshGroup((Face.Y << Lod) / CHUNK_SECTION_HEIGHT, (int32)VoxelBlocks::Get(Face.BlockId).Layer)];
+    }
+}
+
+void FVoxelMesher_Naive::SortBackToFront(TArrayView<FVoxelPackedFace> Faces, const FVector3f& EyeVoxel, int32 Lod)
+{
+    if (Faces.Num() < 2) return;
+
+    // Face centers in voxel units (voxel centers sit on integers): cell center pushed half a
+    // cell along the normal
+    const float S = float(1 << FMath::Clamp(Lod, 0, VOXEL_MAX_LOD));
+    const float Mid = (S - 1.f) * 0.5f;
+    auto DistSq = [&](const FVoxelPackedFace& F)
+        {
+            const FVector3f C(
+                F.X * S + Mid + 0.5f * S * FaceNeighbor[F.Face][0],
+                F.Y * S + Mid + 0.5f * S * FaceNeighbor[F.Face][1],
+                F.Z * S + Mid + 0.5f * S * FaceNeighbor[F.Face][2]);
+            return FVector3f::DistSquared(C, EyeVoxel);
+        };
+    Algo::Sort(Faces, [&DistSq](const FVoxelPackedFace& A, const FVoxelPackedFace& B) { return DistSq(A) > DistSq(B); });
+}
+
+void FVoxelMesher_Naive::ExpandPackedMesh(TConstArrayView<FVoxelPackedFace> Faces, float BlockSize, FVoxelMeshSectionBuffers& Out, int32 Lod)
+{
+    const int32 NumVerts = Faces.Num() * 4;
+    Out.Reset(NumVerts, Faces.Num() * 6);
+
+    const float Half = BlockSize * 0.5f;
+    const float CellSize = BlockSize * float(1 << FMath::Clamp(Lod, 0, VOXEL_MAX_LOD));
+
+    for (const FVoxelPackedFace& Face : Faces)
+    {
+        const uint32 Base = (uint32)Out.Positions.Num();
+
+        // Voxel centers sit on the grid; cube spans +-Half around them. A LOD cell covers
+        // 2^Lod voxels per axis, so its outer faces line up with the full-res chunk edges.
+        const FVector3f Min(Face.X * CellSize - Half, Face.Z * CellSize - Half, Face.Y * CellSize - Half);
+        const float (&Corners)[4][3] = FaceCorners[Face.Face];
+        for (int32 c = 0; c < 4; ++c)
+        {
+            const FVector3f P = Min + FVector3f(Corners[c][0], Corners[c][1], Corners[c][2]) * CellSize;
+            Out.Positions.Add(P);
+            Out.Bounds += P;
+        }
+
+        const uint8 AO[4] = { (uint8)(Face.AO & 3), (uint8)((Face.AO >> 2) & 3), (uint8)((Face.AO >> 4) & 3), (uint8)(Face.AO >> 6) };
+
+        // Flipped winding order for outward normals. Split along the brighter diagonal so a
+        // single dark corner does not bleed across the whole quad.
+        if (AO[0] + AO[2] >= AO[1] + AO[3])
+        {
+            Out.Indices.Add(Base + 0);
+            Out.Indices.Add(Base + 2);
+            Out.Indices.Add(Base + 1);
+            Out.Indices.Add(Base + 0);
+            Out.Indices.Add(Base + 3);
+            Out.Indices.Add(Base + 2);
+        }
+        else
+        {
+            Out.Indices.Add(Base + 0);
+            Out.Indices.Add(Base + 3);
+            Out.Indices.Add(Base + 1);
+            Out.Indices.Add(Base + 1);
+            Out.Indices.Add(Base + 3);
+            Out.Indices.Add(Base + 2);
+        }
+
+        // Everything below is a table lookup
+        const FPackedNormal Normal = FaceTangentZ[Face.Face];
+        const FPackedNormal Tangent = FaceTangentX[Face.Face];
+        const FColor Tint = VoxelBlocks::GetFaceColor(Face.BlockId, Face.Face);
+        const FVoxelAtlasRect& Rect = VoxelBlocks::GetTileRect(Face.Tile);
+        const float U[2] = { Rect.U0, Rect.U1 };
+        const float V[2] = { Rect.V0, Rect.V1 };
+        const uint8 (&UVCorner)[4][2] = FaceUVCorner[Face.Face];
+        for (int32 c = 0; c < 4; ++c)
+        {
+            Out.TangentX.Add(Tangent);
+            Out.TangentZ.Add(Normal);
+            Out.UVs.Add(FVector2f(U[UVCorner[c][0]], V[UVCorner[c][1]]));
+            const uint32 Scale = LightCurve.Scale[(Face.Light[c >> 1] >> ((c & 1) * 4)) & 0x0F];
+            Out.Colors.Add(FColor((uint8)(Tint.R * Scale / 255), (uint8)(Tint.G * Scale / 255), (uint8)(Tint.B * Scale / 255), AOAlpha[AO[c]]));
         }
     }
 }
 
+void FVoxelMesher_Naive::BuildMesh(const FVoxelChunkData& Chunk, float BlockSize, FVoxelMeshSectionBuffers (&Out)[VOXEL_NUM_MESH_GROUPS], int32 Lod)
+{
+    TArray<FVoxelPackedFace> Faces;
+    BuildPackedMeshLod(Chunk, Lod, Faces);
+
+    int32 Counts[VOXEL_NUM_MESH_GROUPS];
+    CountGroups(Faces, Lod, Counts);
+    int32 Start = 0;
+    for (int32 G = 0; G < VOXEL_NUM_MESH_GROUPS; ++G)
+    {
+        ExpandPackedMesh(TConstArrayView<FVoxelPackedFace>(Faces).Slice(Start, Counts[G]), BlockSize, Out[G], Lod);
+        Start += Counts[G];
+    }
+}
+
 bool FVoxelMesher_Naive::IsAirNeighbor(const FVoxelChunkData& Chunk, int32 X, int32 Y, int32 Z, int32 NX, int32 NY, int32 NZ)
 {
     int32 NXAbs = X + NX;
@@ -150,53 +570,3 @@ bool FVoxelMesher_Naive::IsAirNeighbor(const FVoxelChunkData& Chunk, int32 X, in
     EBlockId Neighbor = Chunk.GetBlockAt(NXAbs, NYAbs, NZAbs);
     return (Neighbor == EBlockId::Air);
 }
-
-//void FVoxelMesher_Naive::GetAtlasUVForBlock(EBlockId Id, FVector2D& OutUV0, FVector2D& OutTileSize)
-//{
-//    const int32 TilesAcross = 4;
-//    const float TileSize = 1.0f / static_cast<float>(TilesAcross);
-//
-//    int32 Slot = 0;
-//    switch (Id)
-//    {
-//    case EBlockId::Grass: Slot = 0; break;
-//    case EBlockId::Dirt:  Slot = 1; break;
-//    case EBlockId::Stone: Slot = 2; break;
-//    default: Slot = 3; break;
-//    }
-//
-//    OutUV0 = FVector2D(Slot * TileSize, 0.0f);
-//    OutTileSize = FVector2D(TileSize, 1.0f);
-//}
-
-void FVoxelMesher_Naive::GetAtlasUVForBlock(EBlockId Id, FVector2D& OutUV0, FVector2D& OutTileSize)
-{
-    // Atlas layout (adjust to your real atlas)
-    constexpr int32 TilesAcross = 4;
-    constexpr int32 TilesDown = 1;
-    constexpr int32 AtlasResX = TilesAcross * 64; // 256 if tiles are 64px wide
-    constexpr int32 AtlasResY = TilesDown * 64; // 64  if tiles are 64px tall
-
-    // Inset (gutter) in texels to avoid bleeding from neighbors
-    constexpr int32 PadPx = 2; // try 2; if you still see seams at distance, try 34
-
-    const float TileW = 1.0f / float(TilesAcross);
-    const float TileH = 1.0f / float(TilesDown);
-    const float PadU = float(PadPx) / float(AtlasResX);
-    const float PadV = float(PadPx) / float(AtlasResY);
-
-    int32 slotX = 0, slotY = 0;
-    switch (Id)
-    {
-    case EBlockId::Grass: slotX = 0; break;
-    case EBlockId::Dirt:  slotX = 1; break;
-    case EBlockId::Stone: slotX = 2; break;
-    default:              slotX = 3; break;
-    }
-
-    // Start of the tile + inset
-    OutUV0 = FVector2D(slotX * TileW + PadU, slotY * TileH + PadV);
-    // Shrink tile so we don't touch the outer border
-    OutTileSize = FVector2D(TileW - 2 * PadU, TileH - 2 * PadV);
-}
-
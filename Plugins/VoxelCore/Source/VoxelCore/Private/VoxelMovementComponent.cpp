@@ -0,0 +1,97 @@
+#include "VoxelMovementComponent.h"
+#include "VoxelWorldManager.h"
+#include "EngineUtils.h"
+
+UVoxelMovementComponent::UVoxelMovementComponent()
+{
+    PrimaryComponentTick.bCanEverTick = true;
+}
+
+AVoxelWorldManager* UVoxelMovementComponent::ResolveWorldManager()
+{
+    if (!WorldManager.IsValid() && GetWorld())
+    {
+        for (TActorIterator<AVoxelWorldManager> It(GetWorld()); It; ++It)
+        {
+            WorldManager = *It;
+            break;
+        }
+    }
+    return WorldManager.Get();
+}
+
+bool UVoxelMovementComponent::CanStepUp(const AVoxelWorldManager& World, const FBox& Box, const FVector& Move, float StepHeight)
+{
+    const FVector Up(0.f, 0.f, StepHeight);
+    FVoxelSweepHit Hit;
+    return !World.SweepVoxelBox(Box, Up, Hit) && !World.SweepVoxelBox(Box.ShiftBy(Up), Move, Hit);
+}
+
+void UVoxelMovementComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+    Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+    if (!PawnOwner || !UpdatedComponent || ShouldSkipUpdate(DeltaTime)) return;
+
+    AVoxelWorldManager* World = ResolveWorldManager();
+    if (!World) return;
+
+    // Horizontal velocity chases the input direction; less authority in the air
+    const FVector Input = ConsumeInputVector().GetClampedToMaxSize(1.f);
+    const FVector Target = FVector(Input.X, Input.Y, 0.f) * MaxWalkSpeed;
+    const float Control = bOnGround ? 1.f : AirControl;
+    const float Rate = (Input.IsNearlyZero() ? BrakingDeceleration : Acceleration) * Control;
+    const FVector Horizontal = FMath::VInterpConstantTo(FVector(Velocity.X, Velocity.Y, 0.f), Target, DeltaTime, Rate);
+    Velocity.X = Horizontal.X;
+    Velocity.Y = Horizontal.Y;
+
+    if (bWantsJump && bOnGround)
+    {
+        Velocity.Z = JumpZVelocity;
+    }
+    bWantsJump = false;
+    Velocity.Z += GetGravityZ() * DeltaTime;
+
+    const FVector Extent = UpdatedPrimitive ? UpdatedPrimitive->GetCollisionShape().GetExtent() : UpdatedComponent->Bounds.BoxExtent;
+    const FVector Start = UpdatedComponent->GetComponentLocation();
+    const FVector Delta = Velocity * DeltaTime;
+    const float StepHeight = World->BlockSize;
+
+    // One axis at a time, vertical first so ground contact is known before sliding sideways
+    FVector Location = Start;
+    const bool bWasOnGround = bOnGround;
+    bOnGround = false;
+    for (const int32 Axis : { 2, 0, 1 })
+    {
+        if (Delta[Axis] == 0.0) continue;
+
+        FVector Move = FVector::ZeroVector;
+        Move[Axis] = Delta[Axis];
+        const FBox Box(Location - Extent, Location + Extent);
+
+        FVoxelSweepHit Hit;
+        if (!World->SweepVoxelBox(Box, Move, Hit))
+        {
+            Location += Move;
+            continue;
+        }
+
+        // Walking into a ledge: go up one block if there is room overhead and on top of it
+        if (Axis != 2 && bAutoStep && bWasOnGround && !Hit.bStartPenetrating && CanStepUp(*World, Box, Move, StepHeight))
+        {
+            Location += FVector(0.f, 0.f, StepHeight) + Move;
+            bOnGround = true;
+            continue;
+        }
+
+        Location += Move * Hit.Time;
+        Velocity[Axis] = 0.f;
+        if (Axis == 2 && Delta.Z < 0.0) bOnGround = true;
+    }
+
+    if (!Location.Equals(Start))
+    {
+        UpdatedComponent->SetWorldLocation(Location, /*bSweep=*/false);
+    }
+    UpdateComponentVelocity();
+}
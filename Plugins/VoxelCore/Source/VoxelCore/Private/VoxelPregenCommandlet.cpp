@@ -0,0 +1,123 @@
+#include "VoxelPregenCommandlet.h"
+#include "VoxelWorldManager.h"      // EVoxelWorldSize, GetWorldRadiusForSize
+#include "VoxelGenerator.h"
+#include "VoxelFeatures.h"
+#include "VoxelMesher.h"
+#include "VoxelSaveSystem.h"
+#include "ChunkConfig.h"
+#include "Async/ParallelFor.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/ScopeLock.h"
+
+UVoxelPregenCommandlet::UVoxelPregenCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UVoxelPregenCommandlet::Main(const FString& Params)
+{
+    // --- Parameters ---
+    FVoxelGeneratorConfig Config;
+    FParse::Value(*Params, TEXT("Seed="), Config.Seed);
+    FParse::Value(*Params, TEXT("HeightScale="), Config.HeightScale);
+    FParse::Value(*Params, TEXT("HeightOffset="), Config.HeightOffset);
+    FParse::Value(*Params, TEXT("NoiseFrequency="), Config.NoiseFrequency);
+
+    EVoxelWorldSize Size = EVoxelWorldSize::Small;
+    FString SizeStr;
+    if (FParse::Value(*Params, TEXT("Size="), SizeStr))
+    {
+        if (SizeStr.Equals(TEXT("Medium"), ESearchCase::IgnoreCase)) Size = EVoxelWorldSize::Medium;
+        else if (SizeStr.Equals(TEXT("Large"), ESearchCase::IgnoreCase)) Size = EVoxelWorldSize::Large;
+    }
+
+    int32 Radius = AVoxelWorldManager::GetWorldRadiusForSize(Size);
+    FParse::Value(*Params, TEXT("Radius="), Radius);
+    Radius = FMath::Max(0, Radius);
+
+    const bool bMesh = FParse::Param(*Params, TEXT("Mesh"));
+    const bool bOverwrite = FParse::Param(*Params, TEXT("Overwrite"));
+
+    const int32 Side = Radius * 2 + 1;
+    const int64 Total = (int64)Side * Side;
+    UE_LOG(LogTemp, Display, TEXT("VoxelPregen: seed %d, radius %d (%lld chunks), config %08x, mesh=%d overwrite=%d"),
+        Config.Seed, Radius, Total, Config.GetHash(), bMesh ? 1 : 0, bOverwrite ? 1 : 0);
+
+    // Shared across all workers; sized so one row band of regions stays resident.
+    TSharedPtr<FVoxelFeatureCache> Features = MakeShared<FVoxelFeatureCache>(Config.GetHash(),
+        FMath::Max(256, (Side / FEATURE_REGION_CHUNKS + 3) * 4));
+
+    TAtomic<int64> Written(0);
+    TAtomic<int64> Skipped(0);
+    TAtomic<int64> Done(0);
+    TAtomic<int64> Triangles(0);
+    TAtomic<int64> MeshCycles(0);
+
+    const double Start = FPlatformTime::Seconds();
+    double LastReport = Start;
+    FCriticalSection ReportLock;
+
+    // One task per chunk row; rows are independent and the feature cache is thread-safe.
+    ParallelFor(Side, [&](int32 Row)
+        {
+            const int32 CZ = Row - Radius;
+            FVoxelGenerator Gen(Config);
+            Gen.SetFeatureCache(Features);
+
+            TArray<FVoxelPackedFace> Faces;
+
+            for (int32 CX = -Radius; CX <= Radius; ++CX)
+            {
+                const FChunkKey Key(CX, CZ);
+                if (!bOverwrite && VoxelSaveSystem::HasChunk(Config.Seed, Key))
+                {
+                    ++Skipped;
+                    ++Done;
+                    continue;
+                }
+
+                FVoxelChunkData Data(Key);
+                Gen.GenerateChunk(Key, Data);
+
+                if (bMesh)
+                {
+                    const uint32 MeshStart = FPlatformTime::Cycles();
+                    FVoxelMesher_Naive::BuildPackedMesh(Data, Faces, /*bTwoPass=*/true);
+                    MeshCycles += FPlatformTime::Cycles() - MeshStart;
+                    Triangles += Faces.Num() * 2;
+                }
+
+                // Full snapshot: loads skip generation, and generator changes don't touch it
+                Data.bSnapshotBase = true;
+                VoxelSaveSystem::SaveDelta(Config, Data);
+                ++Written;
+                ++Done;
+            }
+
+            FScopeLock Lock(&ReportLock);
+            const double Now = FPlatformTime::Seconds();
+            if (Now - LastReport >= 5.0)
+            {
+                LastReport = Now;
+                const int64 DoneNow = Done;
+                UE_LOG(LogTemp, Display, TEXT("VoxelPregen: %lld / %lld chunks (%.1f%%), %.1f chunks/s"),
+                    DoneNow, Total, 100.0 * DoneNow / FMath::Max<int64>(Total, 1), DoneNow / FMath::Max(Now - Start, 0.001));
+            }
+        });
+
+    const double Elapsed = FMath::Max(FPlatformTime::Seconds() - Start, 0.001);
+    const int64 WrittenNum = Written;
+    UE_LOG(LogTemp, Display, TEXT("VoxelPregen: wrote %lld chunks, skipped %lld existing in %.2fs (%.1f chunks/s)"),
+        WrittenNum, (int64)Skipped, Elapsed, WrittenNum / Elapsed);
+    if (bMesh && WrittenNum > 0)
+    {
+        // Meshing time is summed over workers, so this is per-core throughput
+        const double MeshSeconds = FMath::Max(FPlatformTime::ToSeconds64((uint64)(int64)MeshCycles), 0.001);
+        UE_LOG(LogTemp, Display, TEXT("VoxelPregen: meshed %lld triangles (%.0f per chunk) in %.2f core-seconds (%.1f chunks/s per core); meshes are not written"),
+            (int64)Triangles, (double)(int64)Triangles / WrittenNum, MeshSeconds, WrittenNum / MeshSeconds);
+    }
+    return 0;
+}
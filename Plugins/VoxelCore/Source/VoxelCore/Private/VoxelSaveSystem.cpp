@@ -1,77 +1,578 @@
 #include "VoxelSaveSystem.h"
 #include "VoxelChunk.h"          // FVoxelChunkData, EBlockId, Data.Key, ModifiedBlocks, SetBlockAt
 #include "ChunkConfig.h"         // CHUNK_SIZE_X/Y/Z
+#include "VoxelGenerator.h"      // FVoxelGeneratorConfig, regenerating old bases
 #include "Misc/Paths.h"
 #include "Misc/FileHelper.h"
 #include "HAL/PlatformFilemanager.h"
+#include "GenericPlatform/GenericPlatformFile.h"
 #include "Serialization/BufferArchive.h"
 #include "Serialization/MemoryReader.h"
 
 static constexpr uint32 VCD_MAGIC = 0x44435631; // 'VCD1'
-static constexpr uint16 VCD_VER = 1;
+static constexpr uint16 VCD_VER_LEGACY = 1;      // deltas only, no generator info
+static constexpr uint16 VCD_VER = 2;
 
-static FString ChunkPath(int32 Seed, const FChunkKey& Key)
+static constexpr uint32 VCS_MAGIC = 0x53435631; // 'VCS1' column summary sidecar
+static constexpr uint16 VCS_VER = 1;
+
+static constexpr uint32 VCE_MAGIC = 0x45435631; // 'VCE1' edits to a chunk that was not loaded
+static constexpr uint16 VCE_VER = 2;          // v2 stores runs; v1 single records are still read
+static constexpr uint16 VCE_VER_RECORDS = 1;
+static constexpr int32 VCE_RUN_BYTES = 7;      // int32 first index, uint16 count, uint8 id
+
+// v2 payload encodings
+enum class EVcdEncoding : uint8
+{
+	Delta = 0, // (index, id) records relative to the generated base
+	Full = 1   // palette-compressed full chunk contents
+};
+
+static FString ChunkPath(int32 Seed, const FChunkKey& Key, const TCHAR* Ext = TEXT("vcd"))
 {
-	const FString Root = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Voxel"), FString::Printf(TEXT("Seed_%d"), Seed));
-	const FString Chunks = FPaths::Combine(Root, TEXT("Chunks"));
+	const FString Chunks = FPaths::Combine(VoxelSaveSystem::GetWorldDir(Seed), TEXT("Chunks"));
 	IFileManager::Get().MakeDirectory(*Chunks, /*Tree=*/true);
-	return FPaths::Combine(Chunks, FString::Printf(TEXT("%d_%d.vcd"), Key.X, Key.Z));
+	return FPaths::Combine(Chunks, FString::Printf(TEXT("%d_%d.%s"), Key.X, Key.Z, Ext));
 }
 
-namespace VoxelSaveSystem
+static void SaveColumnSummary(int32 Seed, const FChunkKey& Key, const TArray<uint8>& Dense)
 {
-	bool LoadDelta(int32 Seed, FVoxelChunkData& Data)
+	constexpr int32 Columns = CHUNK_SIZE_X * CHUNK_SIZE_Z;
+
+	FBufferArchive Ar;
+	uint32 Magic = VCS_MAGIC; uint16 Ver = VCS_VER;
+	Ar << Magic; Ar << Ver;
+
+	uint8 TopY[Columns];
+	uint8 TopId[Columns];
+	for (int32 Col = 0; Col < Columns; ++Col)
 	{
-		const FString Path = ChunkPath(Seed, Data.Key);
-		TArray<uint8> Bytes;
-		if (!FFileHelper::LoadFileToArray(Bytes, *Path) || Bytes.Num() < 10) return false;
+		TopY[Col] = 0;
+		TopId[Col] = 0;
+		// Index = X + Z*SX + Y*SX*SZ, so a column is strided by one layer
+		for (int32 Y = CHUNK_SIZE_Y - 1; Y >= 0; --Y)
+		{
+			const uint8 Id = Dense[Col + Y * Columns];
+			if (Id != 0)
+			{
+				TopY[Col] = (uint8)Y;
+				TopId[Col] = Id;
+				break;
+			}
+		}
+	}
+	Ar.Serialize(TopY, Columns);
+	Ar.Serialize(TopId, Columns);
 
-		FMemoryReader Ar(Bytes);
-		uint32 Magic = 0; uint16 Ver = 0; uint32 Count = 0;
-		Ar << Magic; Ar << Ver; Ar << Count;
-		if (Magic != VCD_MAGIC || Ver != VCD_VER) return false;
+	FFileHelper::SaveArrayToFile(Ar, *ChunkPath(Seed, Key, TEXT("vcs")));
+}
+
+static void SerializeConfig(FArchive& Ar, FVoxelGeneratorConfig& Config)
+{
+	Ar << Config.Seed;
+	Ar << Config.HeightScale;
+	Ar << Config.HeightOffset;
+	Ar << Config.NoiseFrequency;
+	Ar << Config.GeneratorVersion;
+}
+
+static uint8 PaletteBitsFor(int32 PaletteNum)
+{
+	return PaletteNum <= 1 ? 0 : (uint8)FMath::RoundUpToPowerOfTwo(FMath::CeilLogTwo((uint32)PaletteNum));
+}
+
+// Encoded size of a full snapshot, used to pick delta vs full per chunk.
+static int32 EstimatePalettizedBytes(const TArray<uint8>& Dense)
+{
+	bool Seen[256] = {};
+	int32 PaletteNum = 0;
+	for (const uint8 Id : Dense)
+	{
+		if (!Seen[Id]) { Seen[Id] = true; ++PaletteNum; }
+	}
+	const int32 Bits = PaletteBitsFor(PaletteNum);
+	const int32 Words = Bits ? (Dense.Num() + (64 / Bits) - 1) / (64 / Bits) : 0;
+	return 2 + PaletteNum + 1 + 4 + Words * 8;
+}
+
+// Palette + fixed-width indices. Widths are 0/1/2/4/8 bits so entries never straddle words.
+static void WritePalettized(FArchive& Ar, const TArray<uint8>& Dense)
+{
+	int32 Lookup[256];
+	for (int32& L : Lookup) L = INDEX_NONE;
 
-		for (uint32 i = 0; i < Count; ++i)
+	TArray<uint8> Palette;
+	for (const uint8 Id : Dense)
+	{
+		if (Lookup[Id] == INDEX_NONE)
 		{
-			int32 I; uint8 Id;
-			Ar << I; Ar << Id;
+			Lookup[Id] = Palette.Num();
+			Palette.Add(Id);
+		}
+	}
 
-			//const int32 X = I % CHUNK_SIZE_X;
-			//const int32 Y = (I / CHUNK_SIZE_X) % CHUNK_SIZE_Y;
-			//const int32 Z = I / (CHUNK_SIZE_X * CHUNK_SIZE_Y);
+	uint16 PaletteNum = (uint16)Palette.Num();
+	Ar << PaletteNum;
+	Ar.Serialize(Palette.GetData(), PaletteNum);
 
-			const int32 X = I % CHUNK_SIZE_X;
-			const int32 Z = (I / CHUNK_SIZE_X) % CHUNK_SIZE_Z;
-			const int32 Y = I / (CHUNK_SIZE_X * CHUNK_SIZE_Z);
+	uint8 Bits = PaletteBitsFor(PaletteNum);
+	Ar << Bits;
 
-			Data.SetBlockAt(X, Y, Z, static_cast<EBlockId>(Id));
+	TArray<uint64> Words;
+	if (Bits > 0)
+	{
+		const int32 PerWord = 64 / Bits;
+		Words.SetNumZeroed((Dense.Num() + PerWord - 1) / PerWord);
+		for (int32 i = 0; i < Dense.Num(); ++i)
+		{
+			const uint64 V = (uint64)Lookup[Dense[i]];
+			Words[i / PerWord] |= V << ((i % PerWord) * Bits);
 		}
+	}
+
+	uint32 WordNum = (uint32)Words.Num();
+	Ar << WordNum;
+	for (uint64& W : Words) Ar << W;
+}
+
+// Decodes into scratch and only replaces OutDense on success, so a bad payload leaves it untouched.
+static bool ReadPalettized(FArchive& Ar, TArray<uint8>& OutDense)
+{
+	uint16 PaletteNum = 0;
+	Ar << PaletteNum;
+	if (PaletteNum == 0 || PaletteNum > 256) return false;
+
+	uint8 Palette[256];
+	Ar.Serialize(Palette, PaletteNum);
+
+	uint8 Bits = 0; uint32 WordNum = 0;
+	Ar << Bits; Ar << WordNum;
+	if (Ar.IsError()) return false;
+	if (Bits != 0 && Bits != 1 && Bits != 2 && Bits != 4 && Bits != 8) return false;
+
+	TArray<uint8> Decoded;
+	Decoded.SetNumUninitialized(CHUNK_VOLUME);
+	if (Bits == 0)
+	{
+		FMemory::Memset(Decoded.GetData(), Palette[0], CHUNK_VOLUME);
+		if (Ar.IsError()) return false;
+		OutDense = MoveTemp(Decoded);
+		return true;
+	}
+
+	const int32 PerWord = 64 / Bits;
+	if ((int32)WordNum != (CHUNK_VOLUME + PerWord - 1) / PerWord) return false;
+
+	// One bulk read of all words instead of per-word archive calls
+	TArray<uint64> Words;
+	Words.SetNumUninitialized(WordNum);
+	Ar.Serialize(Words.GetData(), (int64)WordNum * sizeof(uint64));
+	if (Ar.IsError()) return false;
+
+	const uint64 Mask = (uint64(1) << Bits) - 1;
+	int32 Out = 0;
+	for (uint32 w = 0; w < WordNum; ++w)
+	{
+		const uint64 W = INTEL_ORDER64(Words[w]);
+		for (int32 k = 0; k < PerWord && Out < CHUNK_VOLUME; ++k, ++Out)
+		{
+			const uint32 P = (uint32)((W >> (k * Bits)) & Mask);
+			if (P >= PaletteNum) return false;
+			Decoded[Out] = Palette[P];
+		}
+	}
+	if (Ar.IsError()) return false;
+
+	OutDense = MoveTemp(Decoded);
+	return true;
+}
+
+// Record = int32 index + uint8 id, little-endian, unaligned.
+static constexpr int32 VCD_DELTA_RECORD_BYTES = 5;
+
+// Bulk-apply delta records straight out of the pre-read file buffer, starting at Ar's position.
+// One reservation, one bounds check per record, no per-field archive calls or XYZ round trip.
+static bool ReadDeltaRecords(const TArray<uint8>& Bytes, FArchive& Ar, uint32 Count, FVoxelChunkData& Target)
+{
+	const int64 Offset = Ar.Tell();
+	const int64 Needed = (int64)Count * VCD_DELTA_RECORD_BYTES;
+	if (Count > (uint32)CHUNK_VOLUME || Offset + Needed > Bytes.Num()) return false;
+	if (Target.Blocks.Num() != CHUNK_VOLUME) return false;
+
+	Target.ModifiedBlocks.Reserve(Target.ModifiedBlocks.Num() + (int32)Count);
+
+	const uint8* Ptr = Bytes.GetData() + Offset;
+	for (uint32 i = 0; i < Count; ++i, Ptr += VCD_DELTA_RECORD_BYTES)
+	{
+		int32 I;
+		FMemory::Memcpy(&I, Ptr, sizeof(int32));
+		I = INTEL_ORDER32(I);
+		const uint8 Id = Ptr[4];
+
+		if ((uint32)I >= (uint32)CHUNK_VOLUME) continue;
+		Target.SetDeltaAtIndex(I, Id);
+	}
+
+	Ar.Seek(Offset + Needed);
+	return true;
+}
+
+// Runs of consecutive indices with the same id, in edit order
+static void WriteEditRuns(TArray<uint8>& Bytes, TConstArrayView<TPair<int32, uint8>> Edits)
+{
+	for (int32 i = 0; i < Edits.Num();)
+	{
+		const int32 First = Edits[i].Key;
+		const uint8 Id = Edits[i].Value;
+		int32 Count = 1;
+		while (i + Count < Edits.Num() && Count < MAX_uint16
+			&& Edits[i + Count].Key == First + Count && Edits[i + Count].Value == Id)
+		{
+			++Count;
+		}
+
+		const int32 I = INTEL_ORDER32(First);
+		const uint16 N = INTEL_ORDER16((uint16)Count);
+		Bytes.Append((const uint8*)&I, 4);
+		Bytes.Append((const uint8*)&N, 2);
+		Bytes.Add(Id);
+		i += Count;
+	}
+}
+
+// .vce edits in write order, expanded to one (index, id) per voxel. False if missing or foreign.
+static bool ReadEditSidecar(const FString& Path, TArray<TPair<int32, uint8>>& Out)
+{
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Path, FILEREAD_Silent)) return false;
+	if (Bytes.Num() < 6) return false;
+
+	uint32 Magic = 0; uint16 Ver = 0;
+	FMemory::Memcpy(&Magic, Bytes.GetData(), 4);
+	FMemory::Memcpy(&Ver, Bytes.GetData() + 4, 2);
+	Ver = INTEL_ORDER16(Ver);
+	if (INTEL_ORDER32(Magic) != VCE_MAGIC || (Ver != VCE_VER && Ver != VCE_VER_RECORDS)) return false;
+
+	// Appends are not atomic; a torn tail record is ignored
+	const int32 RecordBytes = Ver == VCE_VER ? VCE_RUN_BYTES : VCD_DELTA_RECORD_BYTES;
+	const int32 Count = (Bytes.Num() - 6) / RecordBytes;
+	const uint8* Ptr = Bytes.GetData() + 6;
+	for (int32 i = 0; i < Count; ++i, Ptr += RecordBytes)
+	{
+		int32 I;
+		uint16 N = 1;
+		FMemory::Memcpy(&I, Ptr, sizeof(int32));
+		I = INTEL_ORDER32(I);
+		if (Ver == VCE_VER)
+		{
+			FMemory::Memcpy(&N, Ptr + 4, sizeof(uint16));
+			N = INTEL_ORDER16(N);
+		}
+		const uint8 Id = Ptr[RecordBytes - 1];
+		if (I < 0 || (int64)I + N > CHUNK_VOLUME) continue;
+
+		for (int32 k = 0; k < N; ++k)
+		{
+			Out.Add(TPair<int32, uint8>(I + k, Id));
+		}
+	}
+	return true;
+}
+
+// Apply .vce records on top of whatever Data holds now; later records win.
+static bool MergeEditSidecar(int32 Seed, FVoxelChunkData& Data)
+{
+	if (Data.Blocks.Num() != CHUNK_VOLUME) return false;
+
+	TArray<TPair<int32, uint8>> Edits;
+	if (!ReadEditSidecar(ChunkPath(Seed, Data.Key, TEXT("vce")), Edits)) return false;
+
+	for (const TPair<int32, uint8>& E : Edits)
+	{
+		Data.SetDeltaAtIndex(E.Key, E.Value);
+	}
+
+	// Even if the edits cancel out to no deltas, the next save has to run to drop the sidecar
+	Data.bMergedSidecar = true;
+	Data.bUnsaved = true;
+	return Edits.Num() > 0;
+}
+
+struct FVcdHeader
+{
+	uint16 Ver = 0;
+	EVcdEncoding Encoding = EVcdEncoding::Delta;
+	uint32 Hash = 0;
+	FVoxelGeneratorConfig Config;
+};
+
+static bool ReadHeader(FArchive& Ar, FVcdHeader& Out)
+{
+	uint32 Magic = 0;
+	Ar << Magic; Ar << Out.Ver;
+	if (Magic != VCD_MAGIC) return false;
+
+	// Legacy files carry no generator info; treat them as deltas against the current base.
+	if (Out.Ver == VCD_VER_LEGACY) return !Ar.IsError();
+	if (Out.Ver != VCD_VER) return false;
+
+	uint8 Encoding = 0;
+	Ar << Encoding; Ar << Out.Hash;
+	SerializeConfig(Ar, Out.Config);
+	if (Encoding > (uint8)EVcdEncoding::Full) return false;
+	Out.Encoding = (EVcdEncoding)Encoding;
+	return !Ar.IsError();
+}
+
+// Delta saved against another generator config that will be flattened into a snapshot on load
+static bool WillMaterialize(const FVcdHeader& Header, const FVoxelGeneratorConfig& Config, bool bMaterialize)
+{
+	return bMaterialize && Header.Encoding == EVcdEncoding::Delta && Header.Ver != VCD_VER_LEGACY
+		&& Header.Hash != Config.GetHash() && Header.Config.GeneratorVersion == VOXEL_GENERATOR_VERSION;
+}
+
+// Apply the payload following the header. Delta payloads need Data to already hold Config's base,
+// except when materializing, which replaces Blocks wholesale.
+static bool ApplyPayload(const TArray<uint8>& Bytes, FArchive& Ar, const FVcdHeader& Header, const FVoxelGeneratorConfig& Config, FVoxelChunkData& Data, bool bMaterialize)
+{
+	if (Header.Encoding == EVcdEncoding::Full)
+	{
+		if (!ReadPalettized(Ar, Data.Blocks)) return false;
+		Data.ClearDeltas();
+		Data.bSnapshotBase = true;
 		return true;
 	}
 
-	void SaveDelta(int32 Seed, const FVoxelChunkData& Data)
+	uint32 Count = 0;
+	Ar << Count;
+
+	if (Header.Ver == VCD_VER_LEGACY || Header.Hash == Config.GetHash())
+	{
+		return ReadDeltaRecords(Bytes, Ar, Count, Data);
+	}
+
+	if (WillMaterialize(Header, Config, bMaterialize))
+	{
+		// Rebuild what the player actually saw, then freeze it as a full snapshot so it no
+		// longer depends on the old parameters. The chunk's next save writes the snapshot.
+		if (Data.Blocks.Num() != CHUNK_VOLUME) Data.Blocks.SetNumUninitialized(CHUNK_VOLUME);
+		FVoxelChunkData Old(Data.Key);
+		FVoxelGenerator OldGen(Header.Config);
+		OldGen.GenerateChunk(Data.Key, Old);
+		if (!ReadDeltaRecords(Bytes, Ar, Count, Old)) return false;
+
+		Old.GetFlattened(Data.Blocks);
+		Data.ClearDeltas();
+		Data.bSnapshotBase = true;
+		Data.bUnsaved = true;
+
+		UE_LOG(LogTemp, Log, TEXT("VoxelSave: materialized chunk (%d,%d) after generator config change (%08x -> %08x)"),
+			Data.Key.X, Data.Key.Z, Header.Hash, Config.GetHash());
+		return true;
+	}
+
+	// Can't reproduce the old base (materialize off or generator code changed): best effort.
+	UE_LOG(LogTemp, Warning, TEXT("VoxelSave: chunk (%d,%d) saved with generator config %08x, current %08x; applying deltas to new base"),
+		Data.Key.X, Data.Key.Z, Header.Hash, Config.GetHash());
+	return ReadDeltaRecords(Bytes, Ar, Count, Data);
+}
+
+// Saved payload on top of a generated base (or a snapshot instead of one); generates when there is no save.
+static bool LoadSavedChunk(const FVoxelGeneratorConfig& Config, FVoxelChunkData& Data,
+	TFunctionRef<void(FVoxelChunkData&)> GenerateBase, bool bMaterialize)
+{
+	const FString Path = ChunkPath(Config.Seed, Data.Key);
+	TArray<uint8> Bytes;
+	if (!FFileHelper::LoadFileToArray(Bytes, *Path) || Bytes.Num() < 10)
+	{
+		GenerateBase(Data);
+		return false;
+	}
+
+	FMemoryReader Ar(Bytes);
+	FVcdHeader Header;
+	if (!ReadHeader(Ar, Header))
+	{
+		GenerateBase(Data);
+		return false;
+	}
+
+	// Full snapshots replace the base entirely, and materializing builds the old base itself:
+	// neither needs the current one generated.
+	const bool bNeedsBase = Header.Encoding != EVcdEncoding::Full && !WillMaterialize(Header, Config, bMaterialize);
+	if (bNeedsBase)
+	{
+		GenerateBase(Data);
+	}
+	else if (Data.Blocks.Num() != CHUNK_VOLUME)
 	{
-		if (Data.ModifiedBlocks.Num() == 0) return;
+		Data.Blocks.SetNumUninitialized(CHUNK_VOLUME);
+	}
+
+	if (!ApplyPayload(Bytes, Ar, Header, Config, Data, bMaterialize))
+	{
+		// Corrupt payload without a base to fall back on: use a clean generated chunk
+		if (!bNeedsBase)
+		{
+			Data.bSnapshotBase = false;
+			Data.ClearDeltas();
+			GenerateBase(Data);
+		}
+		return false;
+	}
+	return true;
+}
+
+namespace VoxelSaveSystem
+{
+	FString GetWorldDir(int32 Seed)
+	{
+		const FString Root = FPaths::Combine(FPaths::ProjectSavedDir(), TEXT("Voxel"), FString::Printf(TEXT("Seed_%d"), Seed));
+		IFileManager::Get().MakeDirectory(*Root, /*Tree=*/true);
+		return Root;
+	}
+
+	bool LoadDelta(const FVoxelGeneratorConfig& Config, FVoxelChunkData& Data, bool bMaterialize)
+	{
+		const FString Path = ChunkPath(Config.Seed, Data.Key);
+		TArray<uint8> Bytes;
+		bool bApplied = false;
+		if (FFileHelper::LoadFileToArray(Bytes, *Path) && Bytes.Num() >= 10)
+		{
+			FMemoryReader Ar(Bytes);
+			FVcdHeader Header;
+			bApplied = ReadHeader(Ar, Header) && ApplyPayload(Bytes, Ar, Header, Config, Data, bMaterialize);
+		}
+		return MergeEditSidecar(Config.Seed, Data) || bApplied;
+	}
+
+	bool LoadChunk(const FVoxelGeneratorConfig& Config, FVoxelChunkData& Data,
+		TFunctionRef<void(FVoxelChunkData&)> GenerateBase, bool bMaterialize)
+	{
+		const bool bApplied = LoadSavedChunk(Config, Data, GenerateBase, bMaterialize);
+		return MergeEditSidecar(Config.Seed, Data) || bApplied;
+	}
+
+	void AppendEdits(int32 Seed, const FChunkKey& Key, TConstArrayView<TPair<int32, uint8>> Edits)
+	{
+		if (Edits.Num() == 0) return;
+
+		const FString Path = ChunkPath(Seed, Key, TEXT("vce"));
+		IPlatformFile& PF = FPlatformFileManager::Get().GetPlatformFile();
+		bool bFresh = PF.FileSize(*Path) < 6;
+
+		// A sidecar from before runs were stored is rewritten once in the current format
+		TArray<TPair<int32, uint8>> Older;
+		if (!bFresh)
+		{
+			uint16 Ver = 0;
+			if (TUniquePtr<IFileHandle> In{ PF.OpenRead(*Path) })
+			{
+				In->Seek(4);
+				In->Read((uint8*)&Ver, 2);
+			}
+			if (INTEL_ORDER16(Ver) != VCE_VER)
+			{
+				ReadEditSidecar(Path, Older);
+				Older.Append(Edits.GetData(), Edits.Num());
+				Edits = Older;
+				bFresh = true;
+			}
+		}
+
+		TArray<uint8> Bytes;
+		Bytes.Reserve(6 + Edits.Num() * VCE_RUN_BYTES / 4);
+		if (bFresh)
+		{
+			const uint32 Magic = INTEL_ORDER32(VCE_MAGIC);
+			const uint16 Ver = INTEL_ORDER16(VCE_VER);
+			Bytes.Append((const uint8*)&Magic, 4);
+			Bytes.Append((const uint8*)&Ver, 2);
+		}
+		WriteEditRuns(Bytes, Edits);
+
+		TUniquePtr<IFileHandle> File(PF.OpenWrite(*Path, /*bAppend=*/!bFresh));
+		if (!File)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("VoxelSave: cannot append %d edits to %s"), Edits.Num(), *Path);
+			return;
+		}
+		File->Write(Bytes.GetData(), Bytes.Num());
+	}
+
+	bool HasChunk(int32 Seed, const FChunkKey& Key)
+	{
+		return IFileManager::Get().FileExists(*ChunkPath(Seed, Key));
+	}
+
+	void SaveDelta(const FVoxelGeneratorConfig& Config, const FVoxelChunkData& Data)
+	{
+		if (!Data.bSnapshotBase && Data.ModifiedBlocks.Num() == 0 && !Data.bUnsaved) return;
+
+		// Pick the smaller encoding. Snapshot-based chunks have no generated base to diff against.
+		TArray<uint8> Dense;
+		bool bFull = Data.bSnapshotBase;
+		const int32 DeltaBytes = 4 + Data.ModifiedBlocks.Num() * 5;
+		// A snapshot costs at least 1 bit per voxel, so small delta sets never need the estimate.
+		if (!bFull && DeltaBytes > (CHUNK_VOLUME / 64) * 8)
+		{
+			Data.GetFlattened(Dense);
+			bFull = EstimatePalettizedBytes(Dense) < DeltaBytes;
+		}
 
 		FBufferArchive Ar;
 		uint32 Magic = VCD_MAGIC; uint16 Ver = VCD_VER;
-		uint32 Count = (uint32)Data.ModifiedBlocks.Num();
-		Ar << Magic; Ar << Ver; Ar << Count;
+		uint8 Encoding = (uint8)(bFull ? EVcdEncoding::Full : EVcdEncoding::Delta);
+		uint32 Hash = Config.GetHash();
+		FVoxelGeneratorConfig Header = Config;
+		Ar << Magic; Ar << Ver; Ar << Encoding; Ar << Hash;
+		SerializeConfig(Ar, Header);
 
-		//for (const TPair<int32, uint8>& P : Data.ModifiedBlocks)
-		//{
-		//	int32 I = P.Key; uint8 Id = P.Value;
-		//	Ar << I; Ar << Id;
-		//}
-
-		for (const TPair<int32, uint16>& P : Data.ModifiedBlocks) // value is uint16 in your data
+		if (Dense.Num() == 0) Data.GetFlattened(Dense);
+		if (bFull)
 		{
-			int32 I = P.Key;
-			uint8 Id = static_cast<uint8>(P.Value);               // file stays compact (8-bit ids)
-			Ar << I; Ar << Id;
+			WritePalettized(Ar, Dense);
 		}
+		else
+		{
+			uint32 Count = (uint32)Data.ModifiedBlocks.Num();
+			Ar << Count;
 
-		const FString Path = ChunkPath(Seed, Data.Key);
+			for (const TPair<int32, uint16>& P : Data.ModifiedBlocks) // value is uint16 in your data
+			{
+				int32 I = P.Key;
+				uint8 Id = static_cast<uint8>(P.Value);               // file stays compact (8-bit ids)
+				Ar << I; Ar << Id;
+			}
+		}
+
+		const FString Path = ChunkPath(Config.Seed, Data.Key);
 		FFileHelper::SaveArrayToFile(Ar, *Path);
+
+		SaveColumnSummary(Config.Seed, Data.Key, Dense);
+
+		// The sidecar's edits are part of this save now
+		if (Data.bMergedSidecar)
+		{
+			IFileManager::Get().Delete(*ChunkPath(Config.Seed, Data.Key, TEXT("vce")), false, true, true);
+		}
+	}
+
+	bool LoadColumnSummary(int32 Seed, const FChunkKey& Key, FVoxelColumnSummary& Out)
+	{
+		constexpr int32 Columns = CHUNK_SIZE_X * CHUNK_SIZE_Z;
+
+		TArray<uint8> Bytes;
+		if (!FFileHelper::LoadFileToArray(Bytes, *ChunkPath(Seed, Key, TEXT("vcs")), FILEREAD_Silent)) return false;
+		if (Bytes.Num() != 6 + Columns * 2) return false;
+
+		FMemoryReader Ar(Bytes);
+		uint32 Magic = 0; uint16 Ver = 0;
+		Ar << Magic; Ar << Ver;
+		if (Magic != VCS_MAGIC || Ver != VCS_VER) return false;
+
+		Ar.Serialize(Out.TopY, Columns);
+		Ar.Serialize(Out.TopId, Columns);
+		return !Ar.IsError();
 	}
 }
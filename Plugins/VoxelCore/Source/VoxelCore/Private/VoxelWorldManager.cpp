@@ -1,12 +1,89 @@
 #include "VoxelWorldManager.h"
 #include "VoxelChunkActor.h"
 #include "VoxelGenerator.h"
+#include "VoxelFeatures.h"
 #include "VoxelMesher.h"            // FVoxelMesher_Naive
 #include "VoxelTypes.h"
 #include "ChunkConfig.h"
 #include "VoxelSaveSystem.h"
+#include "VoxelFarField.h"
 #include "Kismet/GameplayStatics.h"
 #include "Async/Async.h"
+#include "Async/ParallelFor.h"
+
+namespace
+{
+    // Eye in a chunk's voxel space (X, Y up, Z)
+    FVector3f ToChunkVoxel(const FVector& Eye, float BS, const FChunkKey& Key)
+    {
+        return FVector3f(
+            float(Eye.X / BS) - Key.X * CHUNK_SIZE_X,
+            float(Eye.Z / BS),
+            float(Eye.Y / BS) - Key.Z * CHUNK_SIZE_Z);
+    }
+
+    // Which side of a chunk's translucent box the eye is on, per axis (below/in/above, packed base
+    // 3 as X + 3Y + 9Z); a change means re-sorting
+    int32 ClassifySortSide(const FVector3f& EyeVoxel, const FIntVector& Min, const FIntVector& Max)
+    {
+        auto Axis = [](float E, int32 Lo, int32 Hi) { return E > Hi + 0.5f ? 2 : (E < Lo - 0.5f ? 0 : 1); };
+        return Axis(EyeVoxel.X, Min.X, Max.X) + 3 * Axis(EyeVoxel.Y, Min.Y, Max.Y) + 9 * Axis(EyeVoxel.Z, Min.Z, Max.Z);
+    }
+
+    // Horizontal eye travel (voxels) that re-sorts a chunk whose water the eye is above or beside
+    constexpr float TRANSLUCENT_RESORT_VOXELS = 2.f;
+
+    // Solid lookups for collision queries, in world axis order (X, Y, Z up) with one-chunk caching
+    struct FSolidLookup
+    {
+        const TMap<FChunkKey, FChunkRecord>& Loaded;
+        FChunkKey CachedKey = FChunkKey(MAX_int32, MAX_int32);
+        const FVoxelChunkData* CachedData = nullptr;
+
+        explicit FSolidLookup(const TMap<FChunkKey, FChunkRecord>& InLoaded) : Loaded(InLoaded) {}
+
+        bool IsSolid(int32 WX, int32 WY, int32 WZ)
+        {
+            if (WZ < 0) return true;
+            if (WZ >= CHUNK_SIZE_Y) return false;
+
+            int32 LX = 0, LZ = 0;
+            const FChunkKey Key = GlobalToChunkLocal(WX, WY, LX, LZ);
+            if (!(Key == CachedKey))
+            {
+                CachedKey = Key;
+                const FChunkRecord* Rec = Loaded.Find(Key);
+                CachedData = Rec ? Rec->Data.Get() : nullptr;
+            }
+            if (!CachedData) return true;
+            return VoxelBlocks::Get((uint8)CachedData->GetBlockAt(LX, WZ, LZ)).bSolid;
+        }
+
+        bool AnySolid(const FIntVector& Lo, const FIntVector& Hi, FIntVector* OutCell = nullptr)
+        {
+            for (int32 Z = FMath::Max(Lo.Z, -1); Z <= FMath::Min(Hi.Z, CHUNK_SIZE_Y - 1); ++Z)
+            {
+                for (int32 Y = Lo.Y; Y <= Hi.Y; ++Y)
+                {
+                    for (int32 X = Lo.X; X <= Hi.X; ++X)
+                    {
+                        if (!IsSolid(X, Y, Z)) continue;
+                        if (OutCell) *OutCell = FIntVector(X, Y, Z);
+                        return true;
+                    }
+                }
+            }
+            return false;
+        }
+    };
+
+    // Cells (voxels are centered on grid points) that an interval overlaps by more than a hair,
+    // so resting contact is not an overlap
+    constexpr double CellEps = 1e-4;
+
+    FORCEINLINE int32 FirstCell(double Min, double BS) { return FMath::FloorToInt(Min / BS + 0.5 + CellEps); }
+    FORCEINLINE int32 LastCell(double Max, double BS) { return FMath::CeilToInt(Max / BS + 0.5 - CellEps) - 1; }
+}
 
 AVoxelWorldManager::AVoxelWorldManager()
 {
@@ -17,11 +94,123 @@ AVoxelWorldManager::AVoxelWorldManager()
 void AVoxelWorldManager::BeginPlay()
 {
     Super::BeginPlay();
+
+    FeatureCache = MakeShared<FVoxelFeatureCache>(GetGeneratorConfig().GetHash());
+    MeshPool = MakeShared<FVoxelMeshBufferPool>(FMath::Max(8, MaxConcurrentBackgroundTasks * 2));
+
+    if (bEnableEditJournal)
+    {
+        // Edits left in the journal never reached a chunk save (crash); fold them in first
+        RecoverJournal();
+        FVoxelEditJournal::Discard(WorldSeed);
+        Journal = MakeUnique<FVoxelEditJournal>(WorldSeed);
+    }
+}
+
+void AVoxelWorldManager::RecoverJournal()
+{
+    TArray<FVoxelJournalEntry> Entries;
+    if (!FVoxelEditJournal::Load(WorldSeed, Entries) || Entries.Num() == 0) return;
+
+    // Per chunk in write order, so the last write to each voxel wins
+    TMap<FChunkKey, TArray<int32>> PerChunk;
+    for (int32 i = 0; i < Entries.Num(); ++i)
+    {
+        PerChunk.FindOrAdd(Entries[i].Edit.Key).Add(i);
+    }
+    TArray<FChunkKey> Keys;
+    PerChunk.GenerateKeyArray(Keys);
+
+    const FVoxelGeneratorConfig Config = GetGeneratorConfig();
+    const bool bMaterialize = bMaterializeEditsOnConfigChange;
+    TSharedPtr<FVoxelFeatureCache> Features = FeatureCache;
+    ParallelFor(Keys.Num(), [&](int32 i)
+        {
+            const FChunkKey& Key = Keys[i];
+            FVoxelChunkData Data(Key);
+            VoxelSaveSystem::LoadChunk(Config, Data, [&](FVoxelChunkData& Base)
+                {
+                    FVoxelGenerator Gen(Config);
+                    Gen.SetFeatureCache(Features);
+                    Gen.GenerateChunk(Key, Base);
+                }, bMaterialize);
+
+            for (const int32 E : PerChunk.FindChecked(Key))
+            {
+                Data.SetDeltaAtIndex(Entries[E].Edit.Index, Entries[E].Edit.NewId);
+            }
+            VoxelSaveSystem::SaveDelta(Config, Data);
+        });
+
+    UE_LOG(LogTemp, Log, TEXT("VoxelJournal: recovered %d unsaved edits in %d chunks"), Entries.Num(), Keys.Num());
+}
+
+void AVoxelWorldManager::AppendJournal(TConstArrayView<FVoxelEditRecord> Records, uint32 Transaction)
+{
+    if (!Journal || Records.Num() == 0) return;
+
+    Journal->Append(Records, Transaction);
+    JournalRecords += Records.Num();
+    for (const FVoxelEditRecord& R : Records)
+    {
+        JournaledChunks.Add(R.Key);
+    }
+}
+
+void AVoxelWorldManager::CheckpointJournal()
+{
+    if (!Journal || JournalCheckpointRecords <= 0 || JournalRecords < JournalCheckpointRecords) return;
+
+    // Edits for unloaded chunks count once their sidecar append has landed; edits waiting on a
+    // load have nowhere to go yet, so try again on a later tick
+    if (DeferredEdits.Num() > 0 || SidecarQueued.Num() > 0) return;
+    for (const TPair<FChunkKey, TFuture<void>>& P : SidecarWrites)
+    {
+        if (!P.Value.IsReady()) return;
+    }
+
+    // Loaded chunks with journaled writes go to disk; unloaded ones were saved when they left
+    const FVoxelGeneratorConfig Config = GetGeneratorConfig();
+    int32 Saved = 0;
+    for (const FChunkKey& Key : JournaledChunks)
+    {
+        const FChunkRecord* Rec = Loaded.Find(Key);
+        if (Rec && Rec->Data.IsValid() && (Rec->Data->ModifiedBlocks.Num() > 0 || Rec->Data->bUnsaved))
+        {
+            VoxelSaveSystem::SaveDelta(Config, *Rec->Data);
+            ++Saved;
+        }
+    }
+
+    // Everything the old journal covers is in chunk saves now; the writer drains before it closes
+    Journal.Reset();
+    FVoxelEditJournal::Discard(WorldSeed);
+    Journal = MakeUnique<FVoxelEditJournal>(WorldSeed);
+
+    UE_LOG(LogTemp, Verbose, TEXT("VoxelJournal: checkpoint after %d records, saved %d of %d chunks"),
+        JournalRecords, Saved, JournaledChunks.Num());
+    JournaledChunks.Reset();
+    JournalRecords = 0;
+}
+
+FVoxelGeneratorConfig AVoxelWorldManager::GetGeneratorConfig() const
+{
+    FVoxelGeneratorConfig Config;
+    Config.Seed = WorldSeed;
+    Config.HeightScale = TerrainHeightScale;
+    Config.HeightOffset = TerrainHeightOffset;
+    Config.NoiseFrequency = TerrainNoiseFrequency;
+    return Config;
 }
 
 int32 AVoxelWorldManager::GetWorldRadiusLimit() const
 {
-    switch (WorldSize)
+    return GetWorldRadiusForSize(WorldSize);
+}
+
+int32 AVoxelWorldManager::GetWorldRadiusForSize(EVoxelWorldSize Size)
+{
+    switch (Size)
     {
     case EVoxelWorldSize::Small:  return 16;
     case EVoxelWorldSize::Medium: return 64;
@@ -36,6 +225,20 @@ bool AVoxelWorldManager::IsWithinWorldLimit(const FChunkKey& Key) const
     return FMath::Abs(Key.X) <= R && FMath::Abs(Key.Z) <= R;
 }
 
+int32 AVoxelWorldManager::GetDesiredLod(const FChunkKey& Key) const
+{
+    if (!bEnableLod) return 0;
+
+    const int32 D = FMath::Max(FMath::Abs(Key.X - LodCenter.X), FMath::Abs(Key.Z - LodCenter.Y));
+    const int32 Cap = FMath::Clamp(MaxLod, 0, VOXEL_MAX_LOD);
+    int32 Lod = 0;
+    for (int32 Band = FMath::Max(1, LodFullDetailRadiusChunks); D > Band && Lod < Cap; Band *= 2)
+    {
+        ++Lod;
+    }
+    return Lod;
+}
+
 FIntPoint AVoxelWorldManager::WorldToChunkXZ(const FVector& W) const
 {
     const double CSX = (double)CHUNK_SIZE_X * BlockSize;
@@ -100,237 +303,1905 @@ void AVoxelWorldManager::BuildDesiredOrdered(const FIntPoint& Center, TArray<FCh
         });
 }
 
-void AVoxelWorldManager::KickBuild(const FChunkKey& Key, TSharedPtr<FVoxelChunkData> Existing)
+void AVoxelWorldManager::KickBuild(const FChunkKey& Key, TSharedPtr<FVoxelChunkData> Existing, uint8 SectionMask)
 {
     if (Pending.Contains(Key)) return;
     Pending.Add(Key);
 
-    const int32 Seed = WorldSeed;
+    const FVoxelGeneratorConfig Config = GetGeneratorConfig();
+    const bool bMaterialize = bMaterializeEditsOnConfigChange;
     const float BS = BlockSize;
+    const int32 Lod = GetDesiredLod(Key);
+    const bool bTwoPass = bTwoPassMeshing;
+
+    // Partial remeshes only patch an existing mesh built at the same LOD
+    const FChunkRecord* Rec = Loaded.Find(Key);
+    if (!Rec || !Rec->Actor.IsValid() || Rec->Lod != Lod)
+    {
+        SectionMask = CHUNK_ALL_SECTIONS;
+    }
 
-    Async(EAsyncExecution::ThreadPool, [this, Key, Existing, Seed, BS]()
+    TSharedPtr<FVoxelFeatureCache> Features = FeatureCache;
+    TSharedPtr<FVoxelMeshBufferPool> Pool = MeshPool;
+    const FVector Eye = SortEye;
+    TSharedPtr<FChunkMeshResult> R = AcquireResult();
+    if (Rec)
+    {
+        FMemory::Memcpy(R->SectionSerials, Rec->SectionSerials, sizeof(R->SectionSerials));
+    }
+    else
+    {
+        FMemory::Memzero(R->SectionSerials, sizeof(R->SectionSerials));
+    }
+
+    // Border AO needs the surrounding voxels; coarser LODs only sample their own cells. Both the
+    // ring and a remeshed chunk's own voxels are copied here: edits, fluids, block ticks and
+    // relights keep writing live chunk data (ModifiedBlocks, Light) while the worker runs.
+    FVoxelChunkNeighbors Neighbors;
+    if (Lod == 0)
+    {
+        GatherNeighbors(Key, Neighbors);
+    }
+    TSharedPtr<FVoxelChunkData> Snapshot;
+    if (Existing.IsValid())
+    {
+        Snapshot = MakeShared<FVoxelChunkData>();
+        Snapshot->Key = Key;
+        Existing->GetFlattened(Snapshot->Blocks);
+        if (Lod == 0) Snapshot->Light = Existing->Light;
+    }
+
+    Async(EAsyncExecution::ThreadPool, [this, Key, Existing, Snapshot, Config, bMaterialize, BS, Lod, bTwoPass, Features, Pool, R, Neighbors = MoveTemp(Neighbors), Eye, SectionMask]()
         {
             TSharedPtr<FVoxelChunkData> Data = Existing;
             if (!Data.IsValid())
             {
                 Data = MakeShared<FVoxelChunkData>(Key);
-                FVoxelGenerator Gen(Seed);
-                Gen.GenerateBaseChunk(Key, *Data);
-                VoxelSaveSystem::LoadDelta(Seed, *Data);
+                VoxelSaveSystem::LoadChunk(Config, *Data, [&](FVoxelChunkData& Base)
+                    {
+                        FVoxelGenerator Gen(Config);
+                        Gen.SetFeatureCache(Features);
+                        Gen.GenerateChunk(Key, Base);
+                    }, bMaterialize);
+
+                // Not shared yet, so the full flood fill runs here; the game thread stitches borders
+                VoxelLight::ComputeChunk(*Data, &Neighbors);
+                R->bLightComputed = true;
+                Data->RandomTickSections = VoxelBlockTicks::ScanRandomTickSections(*Data);
             }
 
-            TSharedPtr<FChunkMeshResult> R = MakeShared<FChunkMeshResult>();
             R->Key = Key;
             R->BlockSize = BS;
             R->Data = Data;
+            R->Lod = Lod;
 
-            FVoxelMesher_Naive::BuildMesh(*Data, BS, R->V, R->I, R->N, R->UV, R->C, R->T);
+            // Mesh and expand here so the game thread only hands finished buffers to the component.
+            // A fresh chunk is not shared yet and can be read directly.
+            MeshSections(Snapshot.IsValid() ? *Snapshot : *Data, Lod, &Neighbors, SectionMask, Eye, bTwoPass, *Pool, *R);
 
             Completed.Enqueue(R);
         });
 }
 
-void AVoxelWorldManager::SpawnOrUpdateChunkFromResult(const TSharedPtr<FChunkMeshResult>& Res)
+void AVoxelWorldManager::MeshSections(const FVoxelChunkData& Data, int32 Lod, const FVoxelChunkNeighbors* Neighbors,
+    uint8 SectionMask, const FVector& Eye, bool bTwoPass, FVoxelMeshBufferPool& Pool, FChunkMeshResult& R)
 {
-    if (!Res) return;
-    if (!IsWithinWorldLimit(Res->Key)) return;
+    const float BS = R.BlockSize;
+    R.NeighborMask = Neighbors ? Neighbors->GetMask() : 0;
+    R.SectionMask = SectionMask;
 
-    FChunkRecord& Rec = Loaded.FindOrAdd(Res->Key);
-    Rec.Data = Res->Data;
+    // Packed faces live in per-thread scratch; section storage comes from the pool
+    static thread_local TArray<FVoxelPackedFace> Faces;
+    FVoxelMesher_Naive::BuildPackedMeshLod(Data, Lod, Faces, bTwoPass, Neighbors, SectionMask);
 
-    AVoxelChunkActor* Actor = Rec.Actor.Get();
-    if (!Actor || !IsValid(Actor))
+    int32 Counts[VOXEL_NUM_MESH_GROUPS];
+    FVoxelMesher_Naive::CountGroups(Faces, Lod, Counts);
+
+    int32 Start = 0;
+    for (int32 G = 0; G < VOXEL_NUM_MESH_GROUPS; ++G)
     {
-        const FVector Origin(
-            (double)Res->Key.X * CHUNK_SIZE_X * Res->BlockSize,
-            (double)Res->Key.Z * CHUNK_SIZE_Z * Res->BlockSize,
-            0.0
-        );
-        FActorSpawnParameters SP;
-        SP.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-        Actor = GetWorldChecked()->SpawnActor<AVoxelChunkActor>(Origin, FRotator::ZeroRotator, SP);
-        if (!Actor) return;
-        Actor->BlockSize = Res->BlockSize;
-        Rec.Actor = Actor;
-    }
+        TArrayView<FVoxelPackedFace> Group = TArrayView<FVoxelPackedFace>(Faces).Slice(Start, Counts[G]);
+        Start += Counts[G];
+
+        // Water is kept packed and sorted/expanded below, so re-sorts can redo just that part
+        if (G % VOXEL_NUM_RENDER_LAYERS == (int32)EVoxelRenderLayer::Translucent)
+        {
+            TArray<FVoxelPackedFace>& Kept = R.TranslucentFaces[G / VOXEL_NUM_RENDER_LAYERS];
+            Kept.Reset();
+            Kept.Append(Group.GetData(), Group.Num());
+            continue;
+        }
+        if (Group.Num() == 0) continue;
 
-    Actor->BuildFromBuffers(Res->V, Res->I, Res->N, Res->UV, Res->C, Res->T, ChunkMaterial);
+        R.Sections[G] = Pool.Acquire(Group.Num() * 4);
+        FVoxelMesher_Naive::ExpandPackedMesh(Group, BS, R.Sections[G], Lod);
+    }
+    SortTranslucent(R, Eye, Pool);
 }
 
-void AVoxelWorldManager::UnloadNoLongerNeeded(const TSet<FChunkKey>& Desired)
+void AVoxelWorldManager::SortTranslucent(FChunkMeshResult& R, const FVector& Eye, FVoxelMeshBufferPool& Pool)
 {
-    // Dont erase from a TMap while iterating it  collect keys first.
-    TArray<FChunkKey> ToUnload;
-    ToUnload.Reserve(Loaded.Num());
-
-    for (auto& Pair : Loaded)
+    const FVector3f EyeVoxel = ToChunkVoxel(Eye, R.BlockSize, R.Key);
+    R.SortEye = Eye;
+    for (int32 S = 0; S < CHUNK_NUM_SECTIONS; ++S)
     {
-        const FChunkKey& Key = Pair.Key;
-        FChunkRecord& Rec = Pair.Value;
-
-        if (!Desired.Contains(Key))
-        {
-            // Destroy spawned actor if any
-            if (AVoxelChunkActor* A = Rec.Actor.Get())
-            {
-                A->Destroy();
-                Rec.Actor = nullptr;
-            }
+        TArray<FVoxelPackedFace>& Faces = R.TranslucentFaces[S];
+        if ((R.SectionMask & (1u << S)) == 0 || Faces.Num() == 0) continue;
 
-            // Persist edits (delta) if present
-            if (Rec.Data.IsValid() && Rec.Data->ModifiedBlocks.Num() > 0)
-            {
-                VoxelSaveSystem::SaveDelta(WorldSeed, *Rec.Data);
-            }
+        // Sort water back to front, only where a section has anything to order
+        FVoxelMesher_Naive::SortBackToFront(Faces, EyeVoxel, R.Lod);
 
-            // Mark for removal from the map after the loop
-            ToUnload.Add(Key);
-        }
+        const int32 G = VoxelMeshGroup(S, (int32)EVoxelRenderLayer::Translucent);
+        R.Sections[G] = Pool.Acquire(Faces.Num() * 4);
+        FVoxelMesher_Naive::ExpandPackedMesh(Faces, R.BlockSize, R.Sections[G], R.Lod);
     }
+}
 
-    // Actually remove records from memory now
-    for (const FChunkKey& K : ToUnload)
+void AVoxelWorldManager::UpdateTranslucentSortState(const FChunkKey& Key, FChunkRecord& Rec) const
+{
+    FIntVector Min(MAX_int32), Max(MIN_int32);
+    Rec.bSortedTranslucent = false;
+    for (const TArray<FVoxelPackedFace>& Faces : Rec.TranslucentFaces)
     {
-        Loaded.Remove(K);
-        Pending.Remove(K); // optional: in case something slipped into the queue
+        Rec.bSortedTranslucent |= Faces.Num() > 1;
+        for (const FVoxelPackedFace& F : Faces)
+        {
+            const FIntVector Lo(F.X << Rec.Lod, F.Y << Rec.Lod, F.Z << Rec.Lod);
+            const FIntVector Hi = Lo + FIntVector((1 << Rec.Lod) - 1);
+            Min = FIntVector(FMath::Min(Min.X, Lo.X), FMath::Min(Min.Y, Lo.Y), FMath::Min(Min.Z, Lo.Z));
+            Max = FIntVector(FMath::Max(Max.X, Hi.X), FMath::Max(Max.Y, Hi.Y), FMath::Max(Max.Z, Hi.Z));
+        }
     }
+    if (!Rec.bSortedTranslucent) return;
+
+    Rec.TranslucentMin = Min;
+    Rec.TranslucentMax = Max;
+    Rec.SortSide = ClassifySortSide(ToChunkVoxel(Rec.SortEye, BlockSize, Key), Min, Max);
 }
 
+bool AVoxelWorldManager::NeedsTranslucentResort(const FChunkKey& Key, const FChunkRecord& Rec) const
+{
+    const int32 Side = ClassifySortSide(ToChunkVoxel(SortEye, BlockSize, Key), Rec.TranslucentMin, Rec.TranslucentMax);
+    if (Side != Rec.SortSide) return true;
 
-void AVoxelWorldManager::Tick(float DeltaSeconds)
+    // Within the box's X or Z span the order keeps changing as the eye moves across the water
+    const bool bOverX = Side % 3 == 1;
+    const bool bOverZ = Side / 9 == 1;
+    return (bOverX || bOverZ) && FVector::Dist2D(SortEye, Rec.SortEye) >= TRANSLUCENT_RESORT_VOXELS * BlockSize;
+}
+
+void AVoxelWorldManager::KickTranslucentSort(const FChunkKey& Key, const FChunkRecord& Rec)
 {
-    Super::Tick(DeltaSeconds);
+    Pending.Add(Key);
 
-    // Drain a few completed jobs per frame to avoid hitches
+    TSharedPtr<FChunkMeshResult> R = AcquireResult();
+    R->Key = Key;
+    R->BlockSize = BlockSize;
+    R->Data = Rec.Data;
+    R->Lod = Rec.Lod;
+    R->NeighborMask = Rec.NeighborMask;
+    R->bTranslucentOnly = true;
+    R->SectionMask = 0;
+    FMemory::Memcpy(R->SectionSerials, Rec.SectionSerials, sizeof(R->SectionSerials));
+    for (int32 S = 0; S < CHUNK_NUM_SECTIONS; ++S)
     {
-        int32 Drain = 0;
-        const int32 MaxDrainPerFrame = 4;
-        TSharedPtr<FChunkMeshResult> Res;
-        while (Drain < MaxDrainPerFrame && Completed.Dequeue(Res))
+        if (Rec.TranslucentFaces[S].Num() > 1)
         {
-            Pending.Remove(Res->Key);
-            SpawnOrUpdateChunkFromResult(Res);
-
-            // If edits landed while job was running, resubmit now
-            if (FChunkRecord* Rec = Loaded.Find(Res->Key))
-            {
-                if (Rec->bDirty)
-                {
-                    Rec->bDirty = false;
-                    KickBuild(Res->Key, Rec->Data);
-                }
-            }
-            ++Drain;
+            R->TranslucentFaces[S] = Rec.TranslucentFaces[S];
+            R->SectionMask |= (uint8)(1u << S);
         }
     }
 
-    TimeAcc += DeltaSeconds;
-    if (TimeAcc < UpdateIntervalSeconds) return;
-    TimeAcc = 0.f;
+    TSharedPtr<FVoxelMeshBufferPool> Pool = MeshPool;
+    const FVector Eye = SortEye;
+    Async(EAsyncExecution::ThreadPool, [this, R, Pool, Eye]()
+        {
+            SortTranslucent(*R, Eye, *Pool);
+            Completed.Enqueue(R);
+        });
+}
 
-    AActor* Target = TrackedActor.IsValid() ? TrackedActor.Get()
-        : UGameplayStatics::GetPlayerPawn(GetWorldChecked(), 0);
-    if (!Target) return;
+void AVoxelWorldManager::RemeshForEdit(const FChunkKey& Key, uint8 SectionMask)
+{
+    if (!TryRemeshNow(Key, SectionMask))
+    {
+        QueueRemesh(Key, SectionMask);
+    }
+}
 
-    const FIntPoint Center = WorldToChunkXZ(Target->GetActorLocation());
+bool AVoxelWorldManager::TryRemeshNow(const FChunkKey& Key, uint8 SectionMask)
+{
+    if (!bSyncEditRemesh) return false;
 
-    TSet<FChunkKey> Desired;
-    RecomputeDesiredSet(Center, Desired);
+    // Go async unless the whole remesh is expected to fit in what is left of the budget
+    const int32 NumSections = FMath::CountBits(SectionMask);
+    if (SyncRemeshSecondsThisFrame * 1000.0 + NumSections * SyncRemeshMsPerSection > SyncRemeshBudgetMs) return false;
 
-    TArray<FChunkKey> DesiredOrdered;
-    BuildDesiredOrdered(Center, DesiredOrdered);
+    // Only patches an existing full-detail mesh; anything else takes the async path
+    FChunkRecord* Rec = Loaded.Find(Key);
+    if (!Rec || !Rec->Data.IsValid() || !Rec->Actor.IsValid()) return false;
+    if (Rec->Lod != 0 || GetDesiredLod(Key) != 0) return false;
 
-    UnloadNoLongerNeeded(Desired);
+    const double StartTime = FPlatformTime::Seconds();
 
-    int32 Slots = FMath::Max(0, MaxConcurrentBackgroundTasks - Pending.Num());
-    for (const FChunkKey& K : DesiredOrdered)
+    FVoxelChunkNeighbors Neighbors;
+    GatherNeighbors(Key, Neighbors);
+
+    TSharedPtr<FChunkMeshResult> R = AcquireResult();
+    R->Key = Key;
+    R->BlockSize = BlockSize;
+    R->Data = Rec->Data;
+    R->Lod = 0;
+    MeshSections(*Rec->Data, 0, &Neighbors, SectionMask, SortEye, /*bTwoPass=*/false, *MeshPool, *R);
+
+    // Newer than anything in flight for these sections: bump their serials so stale async
+    // results skip them, and drop edits that this mesh already covers
+    for (int32 S = 0; S < CHUNK_NUM_SECTIONS; ++S)
     {
-        if (Slots <= 0) break;
+        if (SectionMask & (1u << S)) ++Rec->SectionSerials[S];
+    }
+    FMemory::Memcpy(R->SectionSerials, Rec->SectionSerials, sizeof(R->SectionSerials));
+    Rec->DirtySections &= ~SectionMask;
 
-        const FChunkRecord* Rec = Loaded.Find(K);
-        const bool bHasActor = Rec && Rec->Actor.IsValid();
-        if (bHasActor) continue;
-        if (Pending.Contains(K)) continue;
+    SpawnOrUpdateChunkFromResult(R);
+    RecycleResult(R);
 
-        TSharedPtr<FVoxelChunkData> Existing = Rec ? Rec->Data : nullptr;
-        KickBuild(K, Existing);
-        --Slots;
+    const double Seconds = FPlatformTime::Seconds() - StartTime;
+    SyncRemeshSecondsThisFrame += Seconds;
+    if (NumSections > 0)
+    {
+        SyncRemeshMsPerSection = FMath::Lerp(SyncRemeshMsPerSection, Seconds * 1000.0 / NumSections, 0.25);
     }
+    return true;
 }
 
-void AVoxelWorldManager::FlushAllDirtyChunks()
+void AVoxelWorldManager::GatherNeighbors(const FChunkKey& Key, FVoxelChunkNeighbors& Out) const
 {
-    for (auto& Pair : Loaded)
+    for (int32 DZ = -1; DZ <= 1; ++DZ)
     {
-        FChunkRecord& Rec = Pair.Value;
-        if (Rec.Data.IsValid() && Rec.Data->ModifiedBlocks.Num() > 0)
+        for (int32 DX = -1; DX <= 1; ++DX)
         {
-            VoxelSaveSystem::SaveDelta(WorldSeed, *Rec.Data);
-            Rec.bDirty = false;
+            if (DX == 0 && DZ == 0) continue;
+            const FChunkRecord* Rec = Loaded.Find(FChunkKey(Key.X + DX, Key.Z + DZ));
+            if (Rec && Rec->Data.IsValid())
+            {
+                Out.CopyFrom(DX, DZ, *Rec->Data);
+            }
         }
     }
 }
 
-bool AVoxelWorldManager::WorldToVoxel_Centered(const FVector& World,
-    FChunkKey& OutKey, int32& OutX, int32& OutY, int32& OutZ) const
+uint16 AVoxelWorldManager::GetNeighborMask(const FChunkKey& Key) const
 {
-    const double BS = (double)BlockSize;
-
-    const int32 GX = FMath::FloorToInt(World.X / BS + 0.5);
-    const int32 GZ = FMath::FloorToInt(World.Y / BS + 0.5);
-    const int32 GY = FMath::FloorToInt(World.Z / BS + 0.5);
-
-    const int32 CX = FMath::FloorToInt((double)GX / (double)CHUNK_SIZE_X);
-    const int32 CZ = FMath::FloorToInt((double)GZ / (double)CHUNK_SIZE_Z);
-
-    OutX = GX - CX * CHUNK_SIZE_X;
-    OutZ = GZ - CZ * CHUNK_SIZE_Z;
-    OutY = FMath::Clamp(GY, 0, CHUNK_SIZE_Y - 1);
-
-    OutKey = FChunkKey(CX, CZ);
-    return true;
+    uint16 Mask = 0;
+    for (int32 DZ = -1; DZ <= 1; ++DZ)
+    {
+        for (int32 DX = -1; DX <= 1; ++DX)
+        {
+            if (DX == 0 && DZ == 0) continue;
+            const FChunkRecord* Rec = Loaded.Find(FChunkKey(Key.X + DX, Key.Z + DZ));
+            if (Rec && Rec->Data.IsValid()) Mask |= (uint16)(1u << FVoxelChunkNeighbors::Slot(DX, DZ));
+        }
+    }
+    return Mask;
 }
 
-
-bool AVoxelWorldManager::WorldToVoxel_ForEdit(const FVector& World,
-    FChunkKey& OutKey, int32& OutX, int32& OutY, int32& OutZ) const
+void AVoxelWorldManager::QueueRemesh(const FChunkKey& Key, uint8 SectionMask)
 {
-    return WorldToVoxel(World, OutKey, OutX, OutY, OutZ); // forward to your existing mapper
+    FChunkRecord* Rec = Loaded.Find(Key);
+    if (!Rec || !Rec->Data.IsValid()) return;
+
+    // One job per chunk in flight; later edits merge into the next one
+    if (Pending.Contains(Key))
+    {
+        Rec->DirtySections |= SectionMask;
+    }
+    else
+    {
+        KickBuild(Key, Rec->Data, SectionMask);
+    }
 }
 
-bool AVoxelWorldManager::RemoveBlock_Local(const FChunkKey& Key, int32 X, int32 Y, int32 Z)
+void AVoxelWorldManager::AddEditRemesh(TMap<FChunkKey, uint8>& Remesh, const FChunkKey& Key, const FIntVector& Lo, const FIntVector& Hi) const
 {
-    FChunkRecord* Rec = Loaded.Find(Key);
-    if (!Rec || !Rec->Data.IsValid()) return false;
-
-    Rec->Data->SetBlockAt(X, Y, Z, EBlockId::Air);
-    Rec->bDirty = true;
+    const uint8 Mask = VoxelSectionsForRows(Lo.Y, Hi.Y);
+    Remesh.FindOrAdd(Key) |= Mask;
 
-    if (!Pending.Contains(Key))
-        KickBuild(Key, Rec->Data);
+    // Edits on a chunk edge change the faces and AO of the adjacent chunks (diagonal at corners)
+    const int32 DX0 = Lo.X == 0 ? -1 : 0, DX1 = Hi.X == CHUNK_SIZE_X - 1 ? 1 : 0;
+    const int32 DZ0 = Lo.Z == 0 ? -1 : 0, DZ1 = Hi.Z == CHUNK_SIZE_Z - 1 ? 1 : 0;
+    for (int32 DZ = DZ0; DZ <= DZ1; ++DZ)
+    {
+        for (int32 DX = DX0; DX <= DX1; ++DX)
+        {
+            if (DX == 0 && DZ == 0) continue;
 
-    return true;
+            const FChunkKey N(Key.X + DX, Key.Z + DZ);
+            const FChunkRecord* Rec = Loaded.Find(N);
+            if (Rec && Rec->Lod == 0) Remesh.FindOrAdd(N) |= Mask;
+        }
+    }
 }
 
-bool AVoxelWorldManager::PlaceBlock_Local(const FChunkKey& Key, int32 X, int32 Y, int32 Z, uint8 BlockId)
+void AVoxelWorldManager::FlushEditRemesh(TMap<FChunkKey, uint8>& Remesh)
 {
-    FChunkRecord* Rec = Loaded.Find(Key);
-    if (!Rec || !Rec->Data.IsValid()) return false;
-
-    Rec->Data->SetBlockAt(X, Y, Z, static_cast<EBlockId>(BlockId));
-    Rec->bDirty = true;
+    SettleFallingBlocks(Remesh);
+    RelightPending(Remesh);
 
-    if (!Pending.Contains(Key))
-        KickBuild(Key, Rec->Data);
-
-    return true;
+    // One rebuild per chunk; sync within the frame budget, the rest on workers
+    for (const TPair<FChunkKey, uint8>& P : Remesh)
+    {
+        RemeshForEdit(P.Key, P.Value);
+    }
 }
 
-
-void AVoxelWorldManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
+void AVoxelWorldManager::SettleFallingBlocks(TMap<FChunkKey, uint8>& Remesh)
+{
+    // A settled column marks nothing new, so the second pass at most finds nothing to move
+    while (FallDirty.Num() > 0)
+    {
+        TMap<FIntPoint, int32> Columns = MoveTemp(FallDirty);
+        FallDirty.Reset();
+
+        // Every column is read before anything is written, then all moves land as one batch
+        TMap<FChunkKey, TArray<TPair<int32, uint8>>> PerChunk;
+        TArray<TPair<int32, uint8>, TInlineAllocator<16>> Falling; // (original row, id)
+        for (const TPair<FIntPoint, int32>& C : Columns)
+        {
+            int32 LX = 0, LZ = 0;
+            const FChunkKey Key = GlobalToChunkLocal(C.Key.X, C.Key.Y, LX, LZ);
+            const FVoxelChunkData* Data = FindLoadedData(Key);
+            if (!Data) continue;
+
+            auto IdAt = [&](int32 Y) { return Data->GetRawAtIndex(IndexFromXYZ(LX, Y, LZ)); };
+
+            // Landing row: the first open cell above whatever holds the span up
+            int32 Floor = C.Value;
+            while (Floor > 0 && VoxelBlocks::IsFallThrough(IdAt(Floor - 1))) --Floor;
+
+            // Every falling block from there up to the first block that stays put drops as one span
+            Falling.Reset();
+            for (int32 Y = Floor; Y < CHUNK_SIZE_Y; ++Y)
+            {
+                const uint8 Id = IdAt(Y);
+                if (VoxelBlocks::IsFallThrough(Id)) continue;
+                if (!VoxelBlocks::Get(Id).bFalls) break;
+                Falling.Add({ Y, Id });
+            }
+
+            // Stack them from the floor in order; rows they leave above the stack become air. Water
+            // they land in is displaced, not moved: flowing cells would drain anyway and a buried
+            // source is deleted, the same as placing a block over it (the fluid step sees the writes)
+            const int32 Top = Floor + Falling.Num();
+            for (int32 i = 0; i < Falling.Num(); ++i)
+            {
+                const int32 From = Falling[i].Key;
+                const int32 To = Floor + i;
+                if (From == To) continue;
+
+                TArray<TPair<int32, uint8>>& Writes = PerChunk.FindOrAdd(Key);
+                Writes.Add({ IndexFromXYZ(LX, To, LZ), Falling[i].Value });
+                if (From >= Top) Writes.Add({ IndexFromXYZ(LX, From, LZ), (uint8)EBlockId::Air });
+            }
+        }
+        if (PerChunk.Num() == 0) break;
+
+        // Follows whatever edit caused it, as its own non-undoable step
+        WriteEditsPerChunk(PerChunk, Remesh);
+        CommitEdit(/*bUndoable=*/false);
+    }
+}
+
+void AVoxelWorldManager::RelightPending(TMap<FChunkKey, uint8>& Remesh)
+{
+    if (LightDirty.Num() == 0) return;
+
+    VoxelLight::FChanges Changes;
+    VoxelLight::UpdateAfterEdits(LightDirty, [this](const FChunkKey& K) { return FindLoadedData(K); }, Changes);
+    LightDirty.Reset();
+    AddLightRemesh(Remesh, Changes);
+}
+
+void AVoxelWorldManager::AddLightRemesh(TMap<FChunkKey, uint8>& Remesh, const VoxelLight::FChanges& Changes) const
+{
+    // Coarser meshes are drawn fully lit, so only full-detail chunks care
+    for (const TPair<FChunkKey, TPair<FIntVector, FIntVector>>& C : Changes)
+    {
+        const FChunkRecord* Rec = Loaded.Find(C.Key);
+        if (Rec && Rec->Lod == 0) AddEditRemesh(Remesh, C.Key, C.Value.Key, C.Value.Value);
+    }
+}
+
+FVoxelChunkData* AVoxelWorldManager::FindLoadedData(const FChunkKey& Key)
+{
+    FChunkRecord* Rec = Loaded.Find(Key);
+    return Rec ? Rec->Data.Get() : nullptr;
+}
+
+TSharedPtr<FChunkMeshResult> AVoxelWorldManager::AcquireResult()
+{
+    if (FreeResults.Num() > 0)
+    {
+        return FreeResults.Pop(VOXEL_NO_SHRINK);
+    }
+    return MakeShared<FChunkMeshResult>();
+}
+
+void AVoxelWorldManager::RecycleResult(const TSharedPtr<FChunkMeshResult>& Res)
+{
+    // Uploaded section storage goes back to the pool for the next worker
+    for (FVoxelMeshSectionBuffers& Section : Res->Sections)
+    {
+        MeshPool->Release(MoveTemp(Section));
+    }
+    for (TArray<FVoxelPackedFace>& Faces : Res->TranslucentFaces)
+    {
+        Faces.Reset();
+    }
+    Res->Data.Reset();
+    Res->bLightComputed = false;
+    Res->bTranslucentOnly = false;
+
+    if (FreeResults.Num() < MaxConcurrentBackgroundTasks * 2)
+    {
+        FreeResults.Add(Res);
+    }
+}
+
+void AVoxelWorldManager::SpawnOrUpdateChunkFromResult(const TSharedPtr<FChunkMeshResult>& Res)
+{
+    if (!Res) return;
+    if (!IsWithinWorldLimit(Res->Key)) return;
+
+    // Sections remeshed on the game thread after this job was kicked are newer than it
+    auto FindStale = [&Res](const FChunkRecord& Rec)
+        {
+            uint8 StaleMask = 0;
+            for (int32 S = 0; S < CHUNK_NUM_SECTIONS; ++S)
+            {
+                if ((Res->SectionMask & (1u << S)) && Res->SectionSerials[S] != Rec.SectionSerials[S]) StaleMask |= (uint8)(1u << S);
+            }
+            return StaleMask;
+        };
+
+    UMaterialInterface* const Materials[VOXEL_NUM_RENDER_LAYERS] =
+    {
+        ChunkMaterial,
+        CutoutMaterial ? CutoutMaterial : ChunkMaterial,
+        TranslucentMaterial ? TranslucentMaterial : ChunkMaterial,
+    };
+
+    if (Res->bTranslucentOnly)
+    {
+        // Re-sort of the current mesh: only applies to sections still as they were sorted
+        FChunkRecord* Current = Loaded.Find(Res->Key);
+        AVoxelChunkActor* Actor = Current ? Current->Actor.Get() : nullptr;
+        if (!Actor || Current->Lod != Res->Lod) return;
+
+        const uint8 UploadMask = Res->SectionMask & ~FindStale(*Current);
+        if (UploadMask == 0) return;
+        for (int32 S = 0; S < CHUNK_NUM_SECTIONS; ++S)
+        {
+            if (UploadMask & (1u << S)) Current->TranslucentFaces[S] = MoveTemp(Res->TranslucentFaces[S]);
+        }
+        Current->SortEye = Res->SortEye;
+        UpdateTranslucentSortState(Res->Key, *Current);
+        Actor->BuildFromSections(Res->Sections, UploadMask, Materials, /*bCollision=*/false,
+            /*LayerMask=*/1u << (int32)EVoxelRenderLayer::Translucent);
+        return;
+    }
+
+    FChunkRecord& Rec = Loaded.FindOrAdd(Res->Key);
+
+    uint8 UploadMask = Res->SectionMask;
+    const uint8 StaleMask = FindStale(Rec);
+    if (StaleMask != 0)
+    {
+        if (Res->Lod == Rec.Lod)
+        {
+            UploadMask &= ~StaleMask;
+            if (UploadMask == 0) return;
+        }
+        else
+        {
+            // LOD switch: take the whole mesh, then redo the stale sections from current data
+            Rec.DirtySections |= StaleMask;
+        }
+    }
+
+    Rec.Data = Res->Data;
+    Rec.Lod = Res->Lod;
+    // A partial remesh leaves the other sections' AO as it was
+    Rec.NeighborMask = Res->SectionMask == CHUNK_ALL_SECTIONS ? Res->NeighborMask : (Rec.NeighborMask & Res->NeighborMask);
+    // Untouched sections keep their old order, so keep tracking the older eye for them
+    if (Res->SectionMask == CHUNK_ALL_SECTIONS || !Rec.bSortedTranslucent)
+    {
+        Rec.SortEye = Res->SortEye;
+    }
+    for (int32 S = 0; S < CHUNK_NUM_SECTIONS; ++S)
+    {
+        if (UploadMask & (1u << S)) Rec.TranslucentFaces[S] = MoveTemp(Res->TranslucentFaces[S]);
+    }
+    UpdateTranslucentSortState(Res->Key, Rec);
+
+    AVoxelChunkActor* Actor = Rec.Actor.Get();
+    if (!Actor || !IsValid(Actor))
+    {
+        const FVector Origin(
+            (double)Res->Key.X * CHUNK_SIZE_X * Res->BlockSize,
+            (double)Res->Key.Z * CHUNK_SIZE_Z * Res->BlockSize,
+            0.0
+        );
+        FActorSpawnParameters SP;
+        SP.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        Actor = GetWorldChecked()->SpawnActor<AVoxelChunkActor>(Origin, FRotator::ZeroRotator, SP);
+        if (!Actor) return;
+        Actor->BlockSize = Res->BlockSize;
+        if (!bChunkPhysicsCollision)
+        {
+            Actor->ChunkMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+        }
+        Rec.Actor = Actor;
+    }
+
+    // Only full-detail chunks are close enough to be walked on
+    Actor->BuildFromSections(Res->Sections, UploadMask, Materials, /*bCollision=*/bChunkPhysicsCollision && Res->Lod == 0);
+}
+
+void AVoxelWorldManager::UpdateFarField(const FIntPoint& Center)
+{
+    if (!bEnableFarField)
+    {
+        for (auto& Pair : FarTiles)
+        {
+            if (AVoxelChunkActor* A = Pair.Value.Actor.Get()) A->Destroy();
+        }
+        FarTiles.Empty();
+        FarStale.Empty();
+        return;
+    }
+
+    const int32 R = FarFieldRadiusChunks;
+    const FChunkKey TileMin = VoxelFarField::ChunkToTile(FChunkKey(Center.X - R, Center.Y - R), FarTileChunks);
+    const FChunkKey TileMax = VoxelFarField::ChunkToTile(FChunkKey(Center.X + R, Center.Y + R), FarTileChunks);
+
+    auto TileInWorld = [&](const FChunkKey& T)
+        {
+            // Any chunk of the tile inside the world clamp
+            const int32 Limit = GetWorldRadiusLimit();
+            const int32 X0 = T.X * FarTileChunks, Z0 = T.Z * FarTileChunks;
+            return X0 <= Limit && X0 + FarTileChunks - 1 >= -Limit && Z0 <= Limit && Z0 + FarTileChunks - 1 >= -Limit;
+        };
+
+    // Tiles entirely inside the voxel radius would only ever be drawn under meshed chunks
+    const int32 RR = RenderRadiusChunks;
+    auto TileInsideRenderRadius = [&](const FChunkKey& T)
+        {
+            const int32 X0 = T.X * FarTileChunks, Z0 = T.Z * FarTileChunks;
+            return X0 >= Center.X - RR && X0 + FarTileChunks - 1 <= Center.X + RR
+                && Z0 >= Center.Y - RR && Z0 + FarTileChunks - 1 <= Center.Y + RR;
+        };
+
+    // Drop tiles that left the far radius, and fully covered ones inside the voxel radius
+    TArray<FChunkKey> ToRemove;
+    for (auto& Pair : FarTiles)
+    {
+        const FChunkKey& T = Pair.Key;
+        RefreshFarTileVisibility(T, Pair.Value);
+        const bool bAllHidden = Pair.Value.HiddenChunks.Num() > 0 && Pair.Value.HiddenChunks.Find(false) == INDEX_NONE;
+        if (T.X < TileMin.X || T.X > TileMax.X || T.Z < TileMin.Z || T.Z > TileMax.Z
+            || (bAllHidden && TileInsideRenderRadius(T)))
+        {
+            if (AVoxelChunkActor* A = Pair.Value.Actor.Get()) A->Destroy();
+            ToRemove.Add(T);
+        }
+    }
+    for (const FChunkKey& T : ToRemove)
+    {
+        FarTiles.Remove(T);
+        FarStale.Remove(T);
+    }
+
+    // Build missing and stale tiles nearest first
+    TArray<FChunkKey> Missing;
+    for (int32 TZ = TileMin.Z; TZ <= TileMax.Z; ++TZ)
+    {
+        for (int32 TX = TileMin.X; TX <= TileMax.X; ++TX)
+        {
+            const FChunkKey T(TX, TZ);
+            if (!TileInWorld(T) || FarPending.Contains(T)) continue;
+
+            if (FarTiles.Contains(T) ? FarStale.Contains(T) : !TileInsideRenderRadius(T))
+            {
+                Missing.Add(T);
+            }
+        }
+    }
+
+    const FChunkKey CenterTile = VoxelFarField::ChunkToTile(FChunkKey(Center.X, Center.Y), FarTileChunks);
+    Missing.Sort([&](const FChunkKey& A, const FChunkKey& B) {
+        return FMath::Abs(A.X - CenterTile.X) + FMath::Abs(A.Z - CenterTile.Z)
+             < FMath::Abs(B.X - CenterTile.X) + FMath::Abs(B.Z - CenterTile.Z);
+        });
+
+    int32 Slots = FMath::Max(0, MaxConcurrentFarTileTasks - FarPending.Num());
+    for (const FChunkKey& T : Missing)
+    {
+        if (Slots-- <= 0) break;
+        KickFarTile(T);
+    }
+}
+
+void AVoxelWorldManager::KickFarTile(const FChunkKey& Tile)
+{
+    FarPending.Add(Tile);
+    FarStale.Remove(Tile);
+
+    const FVoxelGeneratorConfig Config = GetGeneratorConfig();
+    FVoxelFarTileSettings Settings;
+    Settings.TileChunks = FarTileChunks;
+    Settings.StepVoxels = FarFieldStepVoxels;
+    Settings.BlockSize = BlockSize;
+    Settings.DropUU = FarFieldDropUU;
+
+    const int32 NumChunks = FarTileChunks * FarTileChunks;
+    const int32 Quads = FMath::Square(CHUNK_SIZE_X / FMath::Clamp(FarFieldStepVoxels, 1, CHUNK_SIZE_X));
+    TSharedPtr<FVoxelMeshBufferPool> Pool = MeshPool;
+
+    Async(EAsyncExecution::ThreadPool, [this, Tile, Config, Settings, NumChunks, Quads, Pool]()
+        {
+            TSharedPtr<FFarTileResult> R = MakeShared<FFarTileResult>();
+            R->Tile = Tile;
+            R->Sections.Reserve(NumChunks);
+            for (int32 i = 0; i < NumChunks; ++i)
+            {
+                R->Sections.Add(Pool->Acquire(Quads * 4));
+            }
+            VoxelFarField::BuildTileMesh(Config, Tile, Settings, R->Sections);
+            FarCompleted.Enqueue(R);
+        });
+}
+
+void AVoxelWorldManager::SpawnFarTileFromResult(const TSharedPtr<FFarTileResult>& Res)
+{
+    FarPending.Remove(Res->Tile);
+    if (!bEnableFarField) return;
+
+    const double TileUU = (double)FarTileChunks * CHUNK_SIZE_X * BlockSize;
+    const FVector Origin(Res->Tile.X * TileUU, Res->Tile.Z * TileUU, 0.0);
+
+    FActorSpawnParameters SP;
+    SP.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    AVoxelChunkActor* Actor = GetWorldChecked()->SpawnActor<AVoxelChunkActor>(Origin, FRotator::ZeroRotator, SP);
+    if (!Actor) return;
+
+    // Visual only: no collision cooking, no shadow casting
+    Actor->BlockSize = BlockSize;
+    Actor->ChunkMesh->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Actor->ChunkMesh->SetCastShadow(false);
+    Actor->BuildFromBuffers(Res->Sections, ChunkMaterial, /*bCollision=*/false);
+
+    FFarTileRecord& Rec = FarTiles.FindOrAdd(Res->Tile);
+    if (AVoxelChunkActor* Old = Rec.Actor.Get()) Old->Destroy();
+    Rec.Actor = Actor;
+    Rec.HiddenChunks.Init(false, Res->Sections.Num());
+    RefreshFarTileVisibility(Res->Tile, Rec);
+}
+
+void AVoxelWorldManager::RefreshFarTileVisibility(const FChunkKey& Tile, FFarTileRecord& Rec)
+{
+    AVoxelChunkActor* Actor = Rec.Actor.Get();
+    if (!Actor) return;
+
+    // Each chunk's section hides as soon as that chunk has a real mesh, so the tile never
+    // draws under meshed terrain while its other chunks are still streaming in
+    for (int32 dz = 0; dz < FarTileChunks; ++dz)
+    {
+        for (int32 dx = 0; dx < FarTileChunks; ++dx)
+        {
+            const int32 Section = dx + dz * FarTileChunks;
+            if (!Rec.HiddenChunks.IsValidIndex(Section)) continue;
+
+            const FChunkRecord* C = Loaded.Find(FChunkKey(Tile.X * FarTileChunks + dx, Tile.Z * FarTileChunks + dz));
+            const bool bCovered = C && C->Actor.IsValid();
+            if (bCovered != Rec.HiddenChunks[Section])
+            {
+                Rec.HiddenChunks[Section] = bCovered;
+                Actor->ChunkMesh->SetSectionVisible(Section, !bCovered);
+            }
+        }
+    }
+}
+
+void AVoxelWorldManager::InvalidateFarTile(const FChunkKey& Chunk)
+{
+    // The saved column summary now differs from what the tile was built from
+    if (!bEnableFarField) return;
+    const FChunkKey Tile = VoxelFarField::ChunkToTile(Chunk, FarTileChunks);
+    if (FarTiles.Contains(Tile) || FarPending.Contains(Tile))
+    {
+        FarStale.Add(Tile);
+    }
+}
+
+void AVoxelWorldManager::UnloadNoLongerNeeded(const TSet<FChunkKey>& Desired)
+{
+    // Dont erase from a TMap while iterating it  collect keys first.
+    TArray<FChunkKey> ToUnload;
+    ToUnload.Reserve(Loaded.Num());
+
+    for (auto& Pair : Loaded)
+    {
+        const FChunkKey& Key = Pair.Key;
+        FChunkRecord& Rec = Pair.Value;
+
+        if (!Desired.Contains(Key))
+        {
+            // Destroy spawned actor if any; its collision arrays go back to the pool
+            if (AVoxelChunkActor* A = Rec.Actor.Get())
+            {
+                A->ChunkMesh->ReleaseCollisionStorage(*MeshPool);
+                A->Destroy();
+                Rec.Actor = nullptr;
+            }
+
+            // Persist edits (delta) if present
+            if (Rec.Data.IsValid() && (Rec.Data->ModifiedBlocks.Num() > 0 || Rec.Data->bUnsaved))
+            {
+                VoxelSaveSystem::SaveDelta(GetGeneratorConfig(), *Rec.Data);
+                InvalidateFarTile(Key);
+            }
+
+            // Mark for removal from the map after the loop
+            ToUnload.Add(Key);
+        }
+    }
+
+    // Actually remove records from memory now
+    for (const FChunkKey& K : ToUnload)
+    {
+        Loaded.Remove(K);
+        Pending.Remove(K); // optional: in case something slipped into the queue
+        ScheduledTicks.Remove(K);
+    }
+}
+
+
+void AVoxelWorldManager::Tick(float DeltaSeconds)
+{
+    Super::Tick(DeltaSeconds);
+
+    SyncRemeshSecondsThisFrame = 0.0;
+    PumpSidecarWrites();
+
+    // Edits pushed from other threads land first, so meshes drained below already see them
+    ApplyQueuedEdits();
+    TickFluids(DeltaSeconds);
+    TickBlocks(DeltaSeconds);
+    CheckpointJournal();
+
+    // Drain a few completed jobs per frame to avoid hitches
+    {
+        int32 Drain = 0;
+        const int32 MaxDrainPerFrame = 4;
+        TSharedPtr<FChunkMeshResult> Res;
+        while (Drain < MaxDrainPerFrame && Completed.Dequeue(Res))
+        {
+            Pending.Remove(Res->Key);
+            SpawnOrUpdateChunkFromResult(Res);
+
+            // Freshly lit chunk: trade light with loaded neighbours and refresh whatever changed
+            if (Res->bLightComputed && Loaded.Contains(Res->Key))
+            {
+                VoxelLight::FChanges Changes;
+                VoxelLight::StitchBorders(Res->Key, [this](const FChunkKey& K) { return FindLoadedData(K); }, Changes);
+
+                TMap<FChunkKey, uint8> Remesh;
+                AddLightRemesh(Remesh, Changes);
+                FlushEditRemesh(Remesh);
+
+                // Water that was still moving when the chunk left picks up where it stopped
+                if (TArray<FIntVector>* Parked = FluidParked.Find(Res->Key))
+                {
+                    for (const FIntVector& C : *Parked) FluidActive.Add(C);
+                    FluidParked.Remove(Res->Key);
+                }
+            }
+            ApplyDeferredEdits(Res->Key);
+
+            // If edits landed while job was running, resubmit the sections they touched now
+            if (FChunkRecord* Rec = Loaded.Find(Res->Key))
+            {
+                if (Rec->DirtySections != 0)
+                {
+                    const uint8 Dirty = Rec->DirtySections;
+                    Rec->DirtySections = 0;
+                    KickBuild(Res->Key, Rec->Data, Dirty);
+                }
+            }
+            RecycleResult(Res);
+            ++Drain;
+        }
+
+        TSharedPtr<FFarTileResult> Far;
+        for (int32 FarDrain = 0; FarDrain < 2 && FarCompleted.Dequeue(Far); ++FarDrain)
+        {
+            SpawnFarTileFromResult(Far);
+            for (FVoxelMeshSectionBuffers& Section : Far->Sections)
+            {
+                MeshPool->Release(MoveTemp(Section));
+            }
+        }
+    }
+
+    TimeAcc += DeltaSeconds;
+    if (TimeAcc < UpdateIntervalSeconds) return;
+    TimeAcc = 0.f;
+
+    AActor* Target = TrackedActor.IsValid() ? TrackedActor.Get()
+        : UGameplayStatics::GetPlayerPawn(GetWorldChecked(), 0);
+    if (!Target) return;
+
+    const FIntPoint Center = WorldToChunkXZ(Target->GetActorLocation());
+    LodCenter = Center;
+    SortEye = Target->GetActorLocation();
+
+    TSet<FChunkKey> Desired;
+    RecomputeDesiredSet(Center, Desired);
+
+    TArray<FChunkKey> DesiredOrdered;
+    BuildDesiredOrdered(Center, DesiredOrdered);
+
+    UnloadNoLongerNeeded(Desired);
+
+    int32 Slots = FMath::Max(0, MaxConcurrentBackgroundTasks - Pending.Num());
+    for (const FChunkKey& K : DesiredOrdered)
+    {
+        if (Slots <= 0) break;
+
+        const FChunkRecord* Rec = Loaded.Find(K);
+        const bool bHasActor = Rec && Rec->Actor.IsValid();
+        if (bHasActor) continue;
+        if (Pending.Contains(K)) continue;
+        const bool bLoadsFromDisk = !Rec || !Rec->Data.IsValid();
+        if (bLoadsFromDisk && (SidecarWrites.Contains(K) || SidecarQueued.Contains(K))) continue; // after its edits land
+
+        TSharedPtr<FVoxelChunkData> Existing = Rec ? Rec->Data : nullptr;
+        KickBuild(K, Existing);
+        --Slots;
+    }
+
+    // Streaming neighbours that have not produced data yet
+    auto NeighborsSettled = [&](const FChunkKey& K)
+        {
+            for (int32 DZ = -1; DZ <= 1; ++DZ)
+            {
+                for (int32 DX = -1; DX <= 1; ++DX)
+                {
+                    const FChunkKey N(K.X + DX, K.Z + DZ);
+                    if ((DX != 0 || DZ != 0) && Desired.Contains(N) && !FindLoadedData(N)) return false;
+                }
+            }
+            return true;
+        };
+
+    // Remesh chunks whose LOD band changed, nearest first (data is already in memory).
+    // Also re-sort water (just its groups) once the eye moves to another side of it or across it.
+    for (const FChunkKey& K : DesiredOrdered)
+    {
+        if (Slots <= 0) break;
+
+        const FChunkRecord* Rec = Loaded.Find(K);
+        if (!Rec || !Rec->Actor.IsValid() || !Rec->Data.IsValid()) continue;
+        if (Pending.Contains(K)) continue;
+
+        const int32 Lod = GetDesiredLod(K);
+        bool bRemesh = Rec->Lod != Lod;
+        if (!bRemesh && Lod == 0)
+        {
+            // Neighbours that loaded after this mesh was built: redo border AO once the last
+            // neighbour still streaming in has landed, so arrivals share one remesh
+            bRemesh = (GetNeighborMask(K) & ~Rec->NeighborMask) != 0 && NeighborsSettled(K);
+        }
+        if (!bRemesh && Rec->bSortedTranslucent && NeedsTranslucentResort(K, *Rec))
+        {
+            KickTranslucentSort(K, *Rec);
+            --Slots;
+            continue;
+        }
+        if (!bRemesh) continue;
+
+        KickBuild(K, Rec->Data);
+        --Slots;
+    }
+
+    UpdateFarField(Center);
+}
+
+void AVoxelWorldManager::FlushAllDirtyChunks()
+{
+    for (auto& Pair : Loaded)
+    {
+        FChunkRecord& Rec = Pair.Value;
+        if (Rec.Data.IsValid() && (Rec.Data->ModifiedBlocks.Num() > 0 || Rec.Data->bUnsaved))
+        {
+            VoxelSaveSystem::SaveDelta(GetGeneratorConfig(), *Rec.Data);
+        }
+    }
+}
+
+bool AVoxelWorldManager::WorldToVoxel_Centered(const FVector& World,
+    FChunkKey& OutKey, int32& OutX, int32& OutY, int32& OutZ) const
+{
+    const double BS = (double)BlockSize;
+
+    const int32 GX = FMath::FloorToInt(World.X / BS + 0.5);
+    const int32 GZ = FMath::FloorToInt(World.Y / BS + 0.5);
+    const int32 GY = FMath::FloorToInt(World.Z / BS + 0.5);
+
+    const int32 CX = FMath::FloorToInt((double)GX / (double)CHUNK_SIZE_X);
+    const int32 CZ = FMath::FloorToInt((double)GZ / (double)CHUNK_SIZE_Z);
+
+    OutX = GX - CX * CHUNK_SIZE_X;
+    OutZ = GZ - CZ * CHUNK_SIZE_Z;
+    OutY = FMath::Clamp(GY, 0, CHUNK_SIZE_Y - 1);
+
+    OutKey = FChunkKey(CX, CZ);
+    return true;
+}
+
+
+bool AVoxelWorldManager::WorldToVoxel_ForEdit(const FVector& World,
+    FChunkKey& OutKey, int32& OutX, int32& OutY, int32& OutZ) const
+{
+    return WorldToVoxel(World, OutKey, OutX, OutY, OutZ); // forward to your existing mapper
+}
+
+bool AVoxelWorldManager::RaycastVoxels(const FVector& Start, const FVector& Direction, float MaxDistance, FVoxelRayHit& OutHit) const
+{
+    const FVector Dir = Direction.GetSafeNormal();
+    if (Dir.IsNearlyZero() || BlockSize <= 0.f) return false;
+
+    // Voxel space with cell i spanning [i, i+1) on each axis (voxels are centered on the grid).
+    // Axis order is voxel X, Y (up), Z = world X, Z, Y.
+    const double BS = (double)BlockSize;
+    const double P[3] = { Start.X / BS + 0.5, Start.Z / BS + 0.5, Start.Y / BS + 0.5 };
+    const double D[3] = { Dir.X, Dir.Z, Dir.Y };
+
+    int32 Cell[3];
+    int32 Step[3];
+    double TMax[3];   // ray distance (UU) to the next boundary on each axis
+    double TDelta[3]; // ray distance (UU) across one cell on each axis
+    for (int32 A = 0; A < 3; ++A)
+    {
+        Cell[A] = FMath::FloorToInt(P[A]);
+        if (D[A] > 0.0)
+        {
+            Step[A] = 1;
+            TDelta[A] = BS / D[A];
+            TMax[A] = (Cell[A] + 1 - P[A]) * TDelta[A];
+        }
+        else if (D[A] < 0.0)
+        {
+            Step[A] = -1;
+            TDelta[A] = BS / -D[A];
+            TMax[A] = (P[A] - Cell[A]) * TDelta[A];
+        }
+        else
+        {
+            Step[A] = 0;
+            TDelta[A] = TMax[A] = TNumericLimits<double>::Max();
+        }
+    }
+
+    int32 EnteredAxis = INDEX_NONE;
+    double T = 0.0;
+    FChunkKey CachedKey(MAX_int32, MAX_int32);
+    const FVoxelChunkData* CachedData = nullptr;
+
+    while (T <= MaxDistance)
+    {
+        const int32 CY = Cell[1];
+        if (CY >= 0 && CY < CHUNK_SIZE_Y)
+        {
+            int32 LX = 0, LZ = 0;
+            const FChunkKey Key = GlobalToChunkLocal(Cell[0], Cell[2], LX, LZ);
+            if (!(Key == CachedKey))
+            {
+                CachedKey = Key;
+                const FChunkRecord* Rec = Loaded.Find(Key);
+                CachedData = Rec ? Rec->Data.Get() : nullptr;
+            }
+
+            const uint8 Id = CachedData ? (uint8)CachedData->GetBlockAt(LX, CY, LZ) : (uint8)EBlockId::Air;
+            if (VoxelBlocks::Get(Id).bSolid)
+            {
+                OutHit.Key = Key;
+                OutHit.X = LX;
+                OutHit.Y = CY;
+                OutHit.Z = LZ;
+                OutHit.Global = FIntVector(Cell[0], Cell[1], Cell[2]);
+                OutHit.Normal = FIntVector::ZeroValue;
+                if (EnteredAxis != INDEX_NONE)
+                {
+                    OutHit.Normal[EnteredAxis] = -Step[EnteredAxis];
+                }
+                OutHit.BlockId = Id;
+                OutHit.Distance = T;
+                OutHit.ImpactPoint = Start + Dir * T;
+                return true;
+            }
+        }
+        else if ((CY < 0 && Step[1] <= 0) || (CY >= CHUNK_SIZE_Y && Step[1] >= 0))
+        {
+            return false; // outside the world vertically and not coming back
+        }
+
+        // Step into the neighbour across the nearest boundary
+        const int32 A = TMax[0] < TMax[1] ? (TMax[0] < TMax[2] ? 0 : 2) : (TMax[1] < TMax[2] ? 1 : 2);
+        T = TMax[A];
+        Cell[A] += Step[A];
+        TMax[A] += TDelta[A];
+        EnteredAxis = A;
+    }
+    return false;
+}
+
+bool AVoxelWorldManager::OverlapVoxelBox(const FBox& Box) const
+{
+    const double BS = (double)BlockSize;
+    const FIntVector Lo(FirstCell(Box.Min.X, BS), FirstCell(Box.Min.Y, BS), FirstCell(Box.Min.Z, BS));
+    const FIntVector Hi(LastCell(Box.Max.X, BS), LastCell(Box.Max.Y, BS), LastCell(Box.Max.Z, BS));
+
+    FSolidLookup Lookup(Loaded);
+    return Lookup.AnySolid(Lo, Hi);
+}
+
+bool AVoxelWorldManager::SweepVoxelBox(const FBox& Box, const FVector& Delta, FVoxelSweepHit& OutHit) const
+{
+    OutHit = FVoxelSweepHit();
+    OutHit.Location = Box.GetCenter() + Delta;
+    if (OverlapVoxelBox(Box))
+    {
+        OutHit.bStartPenetrating = true;
+        OutHit.Time = 0.f;
+        OutHit.Location = Box.GetCenter();
+        return true;
+    }
+
+    // Walk the cell boundaries crossed by the leading faces in time order; at each one only the
+    // newly entered slab of cells can block
+    const double BS = (double)BlockSize;
+    int32 Dir[3];
+    int32 NextCell[3];
+    double NextT[3];
+    double StepT[3];
+    for (int32 A = 0; A < 3; ++A)
+    {
+        if (Delta[A] > 0.0)
+        {
+            Dir[A] = 1;
+            NextCell[A] = LastCell(Box.Max[A], BS) + 1;
+            NextT[A] = ((NextCell[A] - 0.5) * BS - Box.Max[A]) / Delta[A];
+            StepT[A] = BS / Delta[A];
+        }
+        else if (Delta[A] < 0.0)
+        {
+            Dir[A] = -1;
+            NextCell[A] = FirstCell(Box.Min[A], BS) - 1;
+            NextT[A] = ((NextCell[A] + 0.5) * BS - Box.Min[A]) / Delta[A];
+            StepT[A] = BS / -Delta[A];
+        }
+        else
+        {
+            Dir[A] = 0;
+            NextCell[A] = 0;
+            NextT[A] = StepT[A] = TNumericLimits<double>::Max();
+        }
+    }
+
+    FSolidLookup Lookup(Loaded);
+    for (;;)
+    {
+        const int32 A = NextT[0] < NextT[1] ? (NextT[0] < NextT[2] ? 0 : 2) : (NextT[1] < NextT[2] ? 1 : 2);
+        const double T = FMath::Max(NextT[A], 0.0);
+        if (T > 1.0) return false;
+
+        const FBox Moved = Box.ShiftBy(Delta * T);
+        FIntVector Lo(FirstCell(Moved.Min.X, BS), FirstCell(Moved.Min.Y, BS), FirstCell(Moved.Min.Z, BS));
+        FIntVector Hi(LastCell(Moved.Max.X, BS), LastCell(Moved.Max.Y, BS), LastCell(Moved.Max.Z, BS));
+        Lo[A] = Hi[A] = NextCell[A];
+
+        FIntVector Cell;
+        if (Lookup.AnySolid(Lo, Hi, &Cell))
+        {
+            OutHit.Voxel = FIntVector(Cell.X, Cell.Z, Cell.Y);
+            OutHit.Time = (float)T;
+            OutHit.Location = Moved.GetCenter();
+            OutHit.Normal = FVector::ZeroVector;
+            OutHit.Normal[A] = -Dir[A];
+            return true;
+        }
+
+        NextCell[A] += Dir[A];
+        NextT[A] += StepT[A];
+    }
+}
+
+bool AVoxelWorldManager::OverlapVoxelCapsule(const FVector& Center, float Radius, float HalfHeight) const
+{
+    const double BS = (double)BlockSize;
+    const double R = Radius;
+    const double SegHalf = FMath::Max((double)HalfHeight - R, 0.0);
+    const double Z0 = Center.Z - SegHalf, Z1 = Center.Z + SegHalf;
+    const double RadiusSq = FMath::Square(FMath::Max(R - CellEps * BS, 0.0));
+
+    const FIntVector Lo(FirstCell(Center.X - R, BS), FirstCell(Center.Y - R, BS), FirstCell(Z0 - R, BS));
+    const FIntVector Hi(LastCell(Center.X + R, BS), LastCell(Center.Y + R, BS), LastCell(Z1 + R, BS));
+
+    FSolidLookup Lookup(Loaded);
+    for (int32 Z = FMath::Max(Lo.Z, -1); Z <= FMath::Min(Hi.Z, CHUNK_SIZE_Y - 1); ++Z)
+    {
+        // Vertical gap between the capsule segment and this cell layer
+        const double CZ0 = (Z - 0.5) * BS, CZ1 = (Z + 0.5) * BS;
+        const double DZ = FMath::Max3(0.0, CZ0 - Z1, Z0 - CZ1);
+        for (int32 Y = Lo.Y; Y <= Hi.Y; ++Y)
+        {
+            const double DY = FMath::Max3(0.0, (Y - 0.5) * BS - Center.Y, Center.Y - (Y + 0.5) * BS);
+            for (int32 X = Lo.X; X <= Hi.X; ++X)
+            {
+                const double DX = FMath::Max3(0.0, (X - 0.5) * BS - Center.X, Center.X - (X + 0.5) * BS);
+                if (DX * DX + DY * DY + DZ * DZ >= RadiusSq) continue;
+                if (Lookup.IsSolid(X, Y, Z)) return true;
+            }
+        }
+    }
+    return false;
+}
+
+bool AVoxelWorldManager::RemoveBlock_Local(const FChunkKey& Key, int32 X, int32 Y, int32 Z)
+{
+    return PlaceBlock_Local(Key, X, Y, Z, (uint8)EBlockId::Air);
+}
+
+bool AVoxelWorldManager::PlaceBlock_Local(const FChunkKey& Key, int32 X, int32 Y, int32 Z, uint8 BlockId)
+{
+    if (X < 0 || X >= CHUNK_SIZE_X || Y < 0 || Y >= CHUNK_SIZE_Y || Z < 0 || Z >= CHUNK_SIZE_Z) return false;
+
+    FChunkRecord* Rec = Loaded.Find(Key);
+    if (!Rec || !Rec->Data.IsValid())
+    {
+        StoreUnloadedEdits(Key, { TPair<int32, uint8>(IndexFromXYZ(X, Y, Z), BlockId) });
+        return true;
+    }
+
+    if (WriteVoxel(Key, *Rec->Data, IndexFromXYZ(X, Y, Z), BlockId))
+    {
+        CommitEdit();
+
+        TMap<FChunkKey, uint8> Remesh;
+        AddEditRemesh(Remesh, Key, FIntVector(X, Y, Z), FIntVector(X, Y, Z));
+        FlushEditRemesh(Remesh);
+    }
+    return true;
+}
+
+void AVoxelWorldManager::SubmitEdit(const FIntVector& Voxel, uint8 BlockId)
+{
+    TArray<FVoxelEditCommand> Batch;
+    Batch.Add({ Voxel, BlockId });
+    EditCommands.Enqueue(MoveTemp(Batch));
+}
+
+void AVoxelWorldManager::SubmitEdits(TArray<FVoxelEditCommand>&& Edits)
+{
+    if (Edits.Num() == 0) return;
+    EditCommands.Enqueue(MoveTemp(Edits));
+}
+
+void AVoxelWorldManager::ApplyQueuedEdits()
+{
+    // Group by chunk, keeping submission order within each so the last write to a voxel wins
+    TMap<FChunkKey, TArray<TPair<int32, uint8>>> PerChunk;
+    TArray<FVoxelEditCommand> Batch;
+    while (EditCommands.Dequeue(Batch))
+    {
+        for (const FVoxelEditCommand& C : Batch)
+        {
+            if (C.Voxel.Y < 0 || C.Voxel.Y >= CHUNK_SIZE_Y) continue;
+
+            int32 LX = 0, LZ = 0;
+            const FChunkKey Key = GlobalToChunkLocal(C.Voxel.X, C.Voxel.Z, LX, LZ);
+            PerChunk.FindOrAdd(Key).Add({ IndexFromXYZ(LX, C.Voxel.Y, LZ), C.BlockId });
+        }
+    }
+    if (PerChunk.Num() == 0) return;
+
+    TMap<FChunkKey, uint8> Remesh;
+    WriteEditsPerChunk(PerChunk, Remesh);
+
+    // Simulation output: journaled, but not a player step to undo
+    CommitEdit(/*bUndoable=*/false);
+    FlushEditRemesh(Remesh);
+}
+
+void AVoxelWorldManager::WriteEditsPerChunk(TMap<FChunkKey, TArray<TPair<int32, uint8>>>& PerChunk, TMap<FChunkKey, uint8>& Remesh)
+{
+    for (TPair<FChunkKey, TArray<TPair<int32, uint8>>>& P : PerChunk)
+    {
+        FChunkRecord* Rec = Loaded.Find(P.Key);
+        if (!Rec || !Rec->Data.IsValid())
+        {
+            StoreUnloadedEdits(P.Key, MoveTemp(P.Value));
+            continue;
+        }
+
+        FIntVector Lo(MAX_int32), Hi(MIN_int32);
+        for (const TPair<int32, uint8>& E : P.Value)
+        {
+            if (!WriteVoxel(P.Key, *Rec->Data, E.Key, E.Value)) continue;
+
+            FIntVector V;
+            XYZFromIndex(E.Key, V.X, V.Y, V.Z);
+            Lo = Lo.ComponentMin(V);
+            Hi = Hi.ComponentMax(V);
+        }
+        if (Lo.X <= Hi.X)
+        {
+            AddEditRemesh(Remesh, P.Key, Lo, Hi);
+        }
+    }
+}
+
+void AVoxelWorldManager::StoreUnloadedEdits(const FChunkKey& Key, TArray<TPair<int32, uint8>>&& Edits)
+{
+    if (Edits.Num() == 0) return;
+
+    // A load job may be reading the save right now; hand these to its result instead
+    if (Pending.Contains(Key))
+    {
+        DeferredEdits.FindOrAdd(Key).Append(MoveTemp(Edits));
+        return;
+    }
+
+    // Also journaled, so replaying older journal entries for this chunk cannot undo them
+    if (Journal)
+    {
+        TArray<FVoxelEditRecord> Records;
+        Records.Reserve(Edits.Num());
+        for (const TPair<int32, uint8>& E : Edits)
+        {
+            Records.Add({ Key, E.Key, E.Value, E.Value });
+        }
+        AppendJournal(Records, NextTransactionId++);
+    }
+
+    // The sidecar append itself happens on a worker
+    SidecarQueued.FindOrAdd(Key).Append(MoveTemp(Edits));
+    PumpSidecarWrites();
+}
+
+void AVoxelWorldManager::PumpSidecarWrites()
+{
+    for (auto It = SidecarWrites.CreateIterator(); It; ++It)
+    {
+        if (It->Value.IsReady()) It.RemoveCurrent();
+    }
+
+    // Appends to one sidecar must land in order, so a chunk waits for its previous write
+    const int32 Seed = WorldSeed;
+    for (auto It = SidecarQueued.CreateIterator(); It; ++It)
+    {
+        if (SidecarWrites.Contains(It->Key)) continue;
+
+        const FChunkKey Key = It->Key;
+        SidecarWrites.Add(Key, Async(EAsyncExecution::ThreadPool, [Seed, Key, Edits = MoveTemp(It->Value)]()
+            {
+                VoxelSaveSystem::AppendEdits(Seed, Key, Edits);
+            }));
+        It.RemoveCurrent();
+    }
+}
+
+void AVoxelWorldManager::ApplyDeferredEdits(const FChunkKey& Key)
+{
+    TArray<TPair<int32, uint8>> Edits;
+    if (!DeferredEdits.RemoveAndCopyValue(Key, Edits)) return;
+
+    FChunkRecord* Rec = Loaded.Find(Key);
+    if (!Rec || !Rec->Data.IsValid())
+    {
+        StoreUnloadedEdits(Key, MoveTemp(Edits));
+        return;
+    }
+
+    FIntVector Lo(MAX_int32), Hi(MIN_int32);
+    for (const TPair<int32, uint8>& E : Edits)
+    {
+        if (!WriteVoxel(Key, *Rec->Data, E.Key, E.Value)) continue;
+
+        FIntVector V;
+        XYZFromIndex(E.Key, V.X, V.Y, V.Z);
+        Lo = Lo.ComponentMin(V);
+        Hi = Hi.ComponentMax(V);
+    }
+    CommitEdit(/*bUndoable=*/false);
+
+    if (Lo.X <= Hi.X)
+    {
+        TMap<FChunkKey, uint8> Remesh;
+        AddEditRemesh(Remesh, Key, Lo, Hi);
+        FlushEditRemesh(Remesh);
+    }
+}
+
+bool AVoxelWorldManager::WriteVoxel(const FChunkKey& Key, FVoxelChunkData& Data, int32 Index, uint8 NewId)
+{
+    const uint8 OldId = Data.GetRawAtIndex(Index);
+    if (OldId == NewId) return false;
+
+    Data.SetDeltaAtIndex(Index, NewId);
+    OpenEdit.Add({ Key, Index, OldId, NewId });
+
+    int32 X, Y, Z;
+    XYZFromIndex(Index, X, Y, Z);
+    const FIntVector Global(Key.X * CHUNK_SIZE_X + X, Y, Key.Z * CHUNK_SIZE_Z + Z);
+
+    // Light only cares when the cell starts or stops passing it (or emitting)
+    const FVoxelBlockDef& Old = VoxelBlocks::Get(OldId);
+    const FVoxelBlockDef& New = VoxelBlocks::Get(NewId);
+    if (Old.bTransparent != New.bTransparent || Old.Emission != New.Emission ||
+        (OldId == (uint8)EBlockId::Air) != (NewId == (uint8)EBlockId::Air))
+    {
+        LightDirty.Add(Global);
+    }
+
+    // Water can only react to cells that hold or could take it
+    if (bSimulateFluids && (VoxelFluid::IsReplaceable(OldId) || VoxelFluid::IsReplaceable(NewId) ||
+        VoxelFluid::IsFluid(OldId) || VoxelFluid::IsFluid(NewId)))
+    {
+        FluidTouched.Add(Global);
+    }
+
+    if (VoxelBlocks::Get(NewId).bRandomTick)
+    {
+        Data.RandomTickSections |= (uint8)(1u << (Y / CHUNK_SECTION_HEIGHT));
+    }
+
+    // Blocks that react to what sits on or under them (same chunk: only Y differs)
+    constexpr int32 Row = CHUNK_SIZE_X * CHUNK_SIZE_Z;
+    if (bEnableBlockTicks)
+    {
+        for (const int32 DY : { 1, -1 })
+        {
+            if (Y + DY < 0 || Y + DY >= CHUNK_SIZE_Y) continue;
+            const uint8 Delay = VoxelBlocks::Get(Data.GetRawAtIndex(Index + DY * Row)).NeighborTickDelay;
+            if (Delay > 0) ScheduleBlockTick(Global + FIntVector(0, DY, 0), Delay);
+        }
+    }
+
+    // Falling blocks only need a look when this write takes away or fails to give support
+    const bool bUnsupported = VoxelBlocks::Get(NewId).bFalls && Y > 0 && VoxelBlocks::IsFallThrough(Data.GetRawAtIndex(Index - Row));
+    const bool bUndercut = VoxelBlocks::IsFallThrough(NewId) && Y + 1 < CHUNK_SIZE_Y && VoxelBlocks::Get(Data.GetRawAtIndex(Index + Row)).bFalls;
+    if (bUnsupported || bUndercut)
+    {
+        const FIntPoint Column(Global.X, Global.Z);
+        if (int32* MinY = FallDirty.Find(Column)) *MinY = FMath::Min(*MinY, Y);
+        else FallDirty.Add(Column, Y);
+    }
+    return true;
+}
+
+void AVoxelWorldManager::CommitEdit(bool bUndoable)
+{
+    if (OpenEdit.Num() == 0) return;
+
+    FVoxelEditTransaction T;
+    T.Id = NextTransactionId++;
+    T.Records = MoveTemp(OpenEdit);
+    OpenEdit.Reset();
+
+    AppendJournal(T.Records, T.Id);
+    if (!bUndoable) return;
+
+    RedoStack.Reset();
+    UndoStack.Add(MoveTemp(T));
+    if (UndoStack.Num() > MaxUndoSteps)
+    {
+        UndoStack.RemoveAt(0, UndoStack.Num() - MaxUndoSteps);
+    }
+}
+
+bool AVoxelWorldManager::ApplyTransaction(const FVoxelEditTransaction& T, bool bUndo)
+{
+    // All or nothing: a chunk that streamed out would leave the edit half applied
+    for (const FVoxelEditRecord& R : T.Records)
+    {
+        const FChunkRecord* Rec = Loaded.Find(R.Key);
+        if (!Rec || !Rec->Data.IsValid())
+        {
+            UE_LOG(LogTemp, Warning, TEXT("Voxel: cannot %s edit %u, chunk (%d,%d) is not loaded"),
+                bUndo ? TEXT("undo") : TEXT("redo"), T.Id, R.Key.X, R.Key.Z);
+            return false;
+        }
+    }
+
+    // Changed bounds per chunk, for one remesh each
+    TMap<FChunkKey, TPair<FIntVector, FIntVector>> Bounds;
+
+    const int32 Num = T.Records.Num();
+    for (int32 i = 0; i < Num; ++i)
+    {
+        const FVoxelEditRecord& R = T.Records[bUndo ? Num - 1 - i : i];
+        FVoxelChunkData& Data = *Loaded.FindChecked(R.Key).Data;
+
+        // Voxels changed since by something outside the history keep their newer id
+        if (Data.GetRawAtIndex(R.Index) != (bUndo ? R.NewId : R.OldId)) continue;
+        WriteVoxel(R.Key, Data, R.Index, bUndo ? R.OldId : R.NewId);
+
+        FIntVector P;
+        XYZFromIndex(R.Index, P.X, P.Y, P.Z);
+        if (TPair<FIntVector, FIntVector>* B = Bounds.Find(R.Key))
+        {
+            B->Key = B->Key.ComponentMin(P);
+            B->Value = B->Value.ComponentMax(P);
+        }
+        else
+        {
+            Bounds.Add(R.Key, { P, P });
+        }
+    }
+
+    // The reverting writes are journaled as a transaction of their own; the stacks are the caller's
+    if (OpenEdit.Num() > 0) AppendJournal(OpenEdit, NextTransactionId++);
+    OpenEdit.Reset();
+
+    TMap<FChunkKey, uint8> Remesh;
+    for (const TPair<FChunkKey, TPair<FIntVector, FIntVector>>& B : Bounds)
+    {
+        AddEditRemesh(Remesh, B.Key, B.Value.Key, B.Value.Value);
+    }
+    FlushEditRemesh(Remesh);
+    return true;
+}
+
+bool AVoxelWorldManager::UndoEdit()
+{
+    if (UndoStack.Num() == 0 || !ApplyTransaction(UndoStack.Last(), /*bUndo=*/true)) return false;
+    RedoStack.Add(UndoStack.Pop(VOXEL_NO_SHRINK));
+    return true;
+}
+
+bool AVoxelWorldManager::RedoEdit()
+{
+    if (RedoStack.Num() == 0 || !ApplyTransaction(RedoStack.Last(), /*bUndo=*/false)) return false;
+    UndoStack.Add(RedoStack.Pop(VOXEL_NO_SHRINK));
+    return true;
+}
+
+
+int32 AVoxelWorldManager::FillBox(const FIntVector& Min, const FIntVector& Max, uint8 BlockId)
+{
+    return EditVolume(Min.ComponentMin(Max), Min.ComponentMax(Max), [](int32, int32, int32) { return true; }, BlockId);
+}
+
+int32 AVoxelWorldManager::FillSphere(const FIntVector& Center, float Radius, uint8 BlockId)
+{
+    if (Radius < 0.f) return 0;
+    const int32 R = FMath::CeilToInt(Radius);
+    const float RadiusSq = Radius * Radius;
+    return EditVolume(Center - FIntVector(R), Center + FIntVector(R), [&](int32 X, int32 Y, int32 Z)
+        {
+            return (float)FMath::Square(X - Center.X) + FMath::Square(Y - Center.Y) + FMath::Square(Z - Center.Z) <= RadiusSq;
+        }, BlockId);
+}
+
+int32 AVoxelWorldManager::FillCylinder(const FIntVector& Base, float Radius, int32 Height, uint8 BlockId)
+{
+    if (Radius < 0.f || Height <= 0) return 0;
+    const int32 R = FMath::CeilToInt(Radius);
+    const float RadiusSq = Radius * Radius;
+    return EditVolume(FIntVector(Base.X - R, Base.Y, Base.Z - R), FIntVector(Base.X + R, Base.Y + Height - 1, Base.Z + R),
+        [&](int32 X, int32, int32 Z)
+        {
+            return (float)FMath::Square(X - Base.X) + FMath::Square(Z - Base.Z) <= RadiusSq;
+        }, BlockId);
+}
+
+int32 AVoxelWorldManager::FillMask(const FIntVector& Origin, const FIntVector& Size, TFunctionRef<bool(int32, int32, int32)> Mask, uint8 BlockId)
+{
+    if (Size.X <= 0 || Size.Y <= 0 || Size.Z <= 0) return 0;
+    return EditVolume(Origin, Origin + Size - FIntVector(1), [&](int32 X, int32 Y, int32 Z)
+        {
+            return Mask(X - Origin.X, Y - Origin.Y, Z - Origin.Z);
+        }, BlockId);
+}
+
+int32 AVoxelWorldManager::EditVolume(const FIntVector& Min, const FIntVector& Max, TFunctionRef<bool(int32, int32, int32)> Inside, uint8 BlockId)
+{
+    const int32 MinY = FMath::Max(Min.Y, 0);
+    const int32 MaxY = FMath::Min(Max.Y, CHUNK_SIZE_Y - 1);
+    if (Min.X > Max.X || Min.Z > Max.Z || MinY > MaxY) return 0;
+
+    int32 Unused = 0;
+    const FChunkKey C0 = GlobalToChunkLocal(Min.X, Min.Z, Unused, Unused);
+    const FChunkKey C1 = GlobalToChunkLocal(Max.X, Max.Z, Unused, Unused);
+
+    // Sections to remesh per chunk, gathered over the whole edit and flushed once at the end
+    TMap<FChunkKey, uint8> Remesh;
+
+    int32 Changed = 0;
+    for (int32 CZ = C0.Z; CZ <= C1.Z; ++CZ)
+    {
+        for (int32 CX = C0.X; CX <= C1.X; ++CX)
+        {
+            const FChunkKey Key(CX, CZ);
+            const int32 BaseX = CX * CHUNK_SIZE_X;
+            const int32 BaseZ = CZ * CHUNK_SIZE_Z;
+            const int32 X0 = FMath::Max(Min.X - BaseX, 0), X1 = FMath::Min(Max.X - BaseX, CHUNK_SIZE_X - 1);
+            const int32 Z0 = FMath::Max(Min.Z - BaseZ, 0), Z1 = FMath::Min(Max.Z - BaseZ, CHUNK_SIZE_Z - 1);
+
+            FChunkRecord* Rec = Loaded.Find(Key);
+            if (!Rec || !Rec->Data.IsValid())
+            {
+                // Not in memory: queue every covered voxel in the save store, no generation
+                TArray<TPair<int32, uint8>> Edits;
+                for (int32 Y = MinY; Y <= MaxY; ++Y)
+                {
+                    for (int32 Z = Z0; Z <= Z1; ++Z)
+                    {
+                        for (int32 X = X0; X <= X1; ++X)
+                        {
+                            if (Inside(BaseX + X, Y, BaseZ + Z)) Edits.Add({ IndexFromXYZ(X, Y, Z), BlockId });
+                        }
+                    }
+                }
+                Changed += Edits.Num();
+                StoreUnloadedEdits(Key, MoveTemp(Edits));
+                continue;
+            }
+            FVoxelChunkData& Data = *Rec->Data;
+
+            // Bounds of what actually changed in this chunk
+            FIntVector Lo(MAX_int32), Hi(MIN_int32);
+            for (int32 Y = MinY; Y <= MaxY; ++Y)
+            {
+                for (int32 Z = Z0; Z <= Z1; ++Z)
+                {
+                    for (int32 X = X0; X <= X1; ++X)
+                    {
+                        if (!Inside(BaseX + X, Y, BaseZ + Z)) continue;
+
+                        if (!WriteVoxel(Key, Data, IndexFromXYZ(X, Y, Z), BlockId)) continue;
+
+                        Lo = Lo.ComponentMin(FIntVector(X, Y, Z));
+                        Hi = Hi.ComponentMax(FIntVector(X, Y, Z));
+                        ++Changed;
+                    }
+                }
+            }
+            if (Lo.X > Hi.X) continue;
+
+            AddEditRemesh(Remesh, Key, Lo, Hi);
+        }
+    }
+
+    CommitEdit();
+    FlushEditRemesh(Remesh);
+    return Changed;
+}
+
+void AVoxelWorldManager::TickFluids(float DeltaSeconds)
+{
+    TSharedPtr<VoxelFluid::FStep> Done;
+    if (FluidCompleted.Dequeue(Done))
+    {
+        bFluidStepInFlight = false;
+        ApplyFluidStep(*Done);
+    }
+
+    // Flowing water changes a few cells per step; rebuild its sections at a slower, fixed pace
+    FluidRemeshAcc += DeltaSeconds;
+    if (FluidRemesh.Num() > 0 && FluidRemeshAcc >= FluidRemeshInterval)
+    {
+        FluidRemeshAcc = 0.f;
+        FlushEditRemesh(FluidRemesh);
+        FluidRemesh.Reset();
+    }
+
+    if (!bSimulateFluids) return;
+
+    // One step in flight at a time; a long frame does not queue up catch-up steps
+    const float Interval = 1.f / FMath::Max(FluidTickRate, 0.5f);
+    FluidAcc = FMath::Min(FluidAcc + DeltaSeconds, Interval);
+    if (bFluidStepInFlight || FluidAcc < Interval) return;
+
+    WakeFluidCells();
+    if (FluidActive.Num() == 0) return;
+
+    FluidAcc = 0.f;
+    KickFluidStep();
+}
+
+void AVoxelWorldManager::WakeFluidCells()
+{
+    if (FluidTouched.Num() == 0) return;
+
+    // Same one-chunk cache as the light and collision lookups
+    FChunkKey CachedKey(MAX_int32, MAX_int32);
+    const FVoxelChunkData* Cached = nullptr;
+    auto GetId = [&](const FIntVector& G) -> uint8
+        {
+            if (G.Y < 0 || G.Y >= CHUNK_SIZE_Y) return (uint8)EBlockId::Air;
+            int32 LX = 0, LZ = 0;
+            const FChunkKey K = GlobalToChunkLocal(G.X, G.Z, LX, LZ);
+            if (!(K == CachedKey))
+            {
+                CachedKey = K;
+                Cached = FindLoadedData(K);
+            }
+            return Cached ? Cached->GetRawAtIndex(IndexFromXYZ(LX, G.Y, LZ)) : (uint8)EBlockId::Air;
+        };
+
+    // Face neighbours, plus the side cells one up: they check this cell for a drop before spreading
+    static const FIntVector Around[10] =
+    {
+        FIntVector(1, 0, 0), FIntVector(-1, 0, 0), FIntVector(0, 1, 0), FIntVector(0, -1, 0), FIntVector(0, 0, 1), FIntVector(0, 0, -1),
+        FIntVector(1, 1, 0), FIntVector(-1, 1, 0), FIntVector(0, 1, 1), FIntVector(0, 1, -1),
+    };
+
+    // A write wakes itself and its neighbours only if there is water next to it; dry edits cost one look
+    for (const FIntVector& G : FluidTouched)
+    {
+        bool bWet = VoxelFluid::IsFluid(GetId(G));
+        for (int32 D = 0; D < 10 && !bWet; ++D)
+        {
+            bWet = VoxelFluid::IsFluid(GetId(G + Around[D]));
+        }
+        if (!bWet) continue;
+
+        FluidActive.Add(G);
+        for (const FIntVector& D : Around)
+        {
+            FluidActive.Add(G + D);
+        }
+    }
+    FluidTouched.Reset();
+}
+
+void AVoxelWorldManager::KickFluidStep()
+{
+    TSharedPtr<VoxelFluid::FStep> Step = MakeShared<VoxelFluid::FStep>();
+    Step->Cells.Reserve(FMath::Min(FluidActive.Num(), MaxFluidCellsPerStep));
+
+    // Dense copy for the worker: edits keep rewriting ModifiedBlocks on this thread while it runs
+    auto CopyChunk = [this, &Step](const FChunkKey& K)
+        {
+            if (Step->Chunks.Contains(K)) return;
+            const FChunkRecord* Rec = Loaded.Find(K);
+            if (Rec && Rec->Data.IsValid()) Rec->Data->GetFlattened(Step->Chunks.Add(K));
+        };
+
+    // Chunks whose cells are in the step, with all four sides copied. A chunk may already be in
+    // Chunks as some other chunk's side, which says nothing about its own sides.
+    TSet<FChunkKey> Gathered;
+    for (auto It = FluidActive.CreateIterator(); It && Step->Cells.Num() < MaxFluidCellsPerStep; ++It)
+    {
+        const FIntVector G = *It;
+        It.RemoveCurrent();
+        if (G.Y < 0 || G.Y >= CHUNK_SIZE_Y) continue;
+
+        int32 LX = 0, LZ = 0;
+        const FChunkKey Key = GlobalToChunkLocal(G.X, G.Z, LX, LZ);
+        if (!Gathered.Contains(Key))
+        {
+            const FChunkRecord* Rec = Loaded.Find(Key);
+            if (!Rec || !Rec->Data.IsValid())
+            {
+                FluidParked.FindOrAdd(Key).Add(G);
+                continue;
+            }
+
+            // The cell's chunk plus its sides cover every neighbour a cell reads
+            Gathered.Add(Key);
+            CopyChunk(Key);
+            for (const FIntPoint& D : { FIntPoint(1, 0), FIntPoint(-1, 0), FIntPoint(0, 1), FIntPoint(0, -1) })
+            {
+                CopyChunk(FChunkKey(Key.X + D.X, Key.Z + D.Y));
+            }
+        }
+        Step->Cells.Add(G);
+    }
+
+    if (Step->Cells.Num() == 0) return;
+
+    bFluidStepInFlight = true;
+    Async(EAsyncExecution::ThreadPool, [this, Step]()
+        {
+            VoxelFluid::Run(*Step);
+            FluidCompleted.Enqueue(Step);
+        });
+}
+
+void AVoxelWorldManager::ApplyFluidStep(VoxelFluid::FStep& Step)
+{
+    // Same per-chunk batching as SubmitEdits; writes whose cell changed while the step ran are
+    // re-simulated instead of clobbering the newer block
+    TMap<FChunkKey, TArray<TPair<int32, uint8>>> PerChunk;
+    for (const VoxelFluid::FWrite& W : Step.Writes)
+    {
+        int32 LX = 0, LZ = 0;
+        const FChunkKey Key = GlobalToChunkLocal(W.Cell.X, W.Cell.Z, LX, LZ);
+        const FVoxelChunkData* Data = FindLoadedData(Key);
+        if (!Data)
+        {
+            FluidParked.FindOrAdd(Key).Add(W.Cell);
+            continue;
+        }
+
+        const int32 Index = IndexFromXYZ(LX, W.Cell.Y, LZ);
+        if (Data->GetRawAtIndex(Index) != W.OldId)
+        {
+            FluidActive.Add(W.Cell);
+            continue;
+        }
+        PerChunk.FindOrAdd(Key).Add({ Index, W.NewId });
+    }
+    Step.Chunks.Reset();
+    if (PerChunk.Num() == 0) return;
+
+    // Remeshing waits for the throttled flush in TickFluids; the writes wake their neighbours
+    WriteEditsPerChunk(PerChunk, FluidRemesh);
+    CommitEdit(/*bUndoable=*/false);
+}
+
+void AVoxelWorldManager::ScheduleBlockTick(const FIntVector& Voxel, int32 DelayTicks)
+{
+    if (Voxel.Y < 0 || Voxel.Y >= CHUNK_SIZE_Y) return;
+
+    int32 LX = 0, LZ = 0;
+    const FChunkKey Key = GlobalToChunkLocal(Voxel.X, Voxel.Z, LX, LZ);
+    if (!FindLoadedData(Key)) return;
+
+    FVoxelScheduledTick T;
+    T.Due = BlockTickCount + (uint64)FMath::Max(DelayTicks, 1);
+    T.Index = IndexFromXYZ(LX, Voxel.Y, LZ);
+    ScheduledTicks.FindOrAdd(Key).Push(T);
+}
+
+void AVoxelWorldManager::TickBlocks(float DeltaSeconds)
+{
+    if (!bEnableBlockTicks) return;
+
+    // Same fixed-step pacing as fluids: a slow frame delays ticks rather than bunching them
+    const float Interval = 1.f / FMath::Max(BlockTickRate, 1.f);
+    BlockTickAcc = FMath::Min(BlockTickAcc + DeltaSeconds, Interval);
+    if (BlockTickAcc < Interval) return;
+
+    BlockTickAcc = 0.f;
+    RunBlockTickStep();
+}
+
+void AVoxelWorldManager::RunBlockTickStep()
+{
+    ++BlockTickCount;
+
+    // One job per chunk with due ticks or random-ticking sections; quiet chunks cost one lookup.
+    // The scan starts where the last step ran out of either budget so no chunk's ticks wait forever.
+    TArray<FChunkKey> Keys;
+    Loaded.GetKeys(Keys);
+    const int32 Start = Keys.Num() > 0 ? BlockTickCursor % Keys.Num() : 0;
+
+    TArray<VoxelBlockTicks::FChunkJob> Jobs;
+    int32 Budget = MaxScheduledTicksPerStep;
+    int32 RandomBudget = MaxRandomTicksPerStep;
+    int32 NextCursor = INDEX_NONE;
+    for (int32 N = 0; N < Keys.Num(); ++N)
+    {
+        const FChunkKey& Key = Keys[(Start + N) % Keys.Num()];
+        const FVoxelChunkData* Data = Loaded[Key].Data.Get();
+        if (!Data) continue;
+
+        FVoxelTickQueue* Queue = ScheduledTicks.Find(Key);
+        const bool bDue = Queue && Queue->Heap.Num() > 0 && Queue->Heap.HeapTop().Due <= BlockTickCount && Budget > 0;
+
+        // A chunk's random samples run whole or not at all this step
+        const int32 RandomCost = RandomTicksPerSection * FMath::CountBits(Data->RandomTickSections);
+        bool bRandom = RandomCost > 0;
+        if (bRandom && RandomCost > RandomBudget && RandomBudget < MaxRandomTicksPerStep)
+        {
+            RandomBudget = 0;
+            bRandom = false;
+            if (NextCursor == INDEX_NONE) NextCursor = Start + N;
+        }
+        if (!bDue && !bRandom) continue;
+
+        VoxelBlockTicks::FChunkJob& Job = Jobs.AddDefaulted_GetRef();
+        Job.Key = Key;
+        Job.Data = Data;
+        Job.RandomPerSection = bRandom ? RandomTicksPerSection : 0;
+        Job.Seed = BlockTickRandom.RandHelper(MAX_int32);
+        if (bRandom) RandomBudget = FMath::Max(RandomBudget - RandomCost, 0);
+        while (bDue && Budget > 0 && Queue->Heap.Num() > 0 && Queue->Heap.HeapTop().Due <= BlockTickCount)
+        {
+            FVoxelScheduledTick T;
+            Queue->Pop(T);
+            Job.Scheduled.Add(T.Index);
+            if (--Budget == 0 && NextCursor == INDEX_NONE) NextCursor = Start + N; // this chunk may still have due ticks
+        }
+        if (Queue && Queue->Heap.Num() == 0)
+        {
+            ScheduledTicks.Remove(Key);
+        }
+    }
+    if (NextCursor != INDEX_NONE) BlockTickCursor = NextCursor;
+    if (Jobs.Num() == 0) return;
+
+    // Jobs only read voxels, and nothing writes them until ParallelFor returns
+    ParallelFor(Jobs.Num(), [this, &Jobs](int32 I)
+        {
+            VoxelBlockTicks::RunChunk(Jobs[I], [this](const FChunkKey& K) -> const FVoxelChunkData*
+                {
+                    const FChunkRecord* Rec = Loaded.Find(K);
+                    return Rec ? Rec->Data.Get() : nullptr;
+                });
+        });
+
+    // Results go through the per-chunk edit batch: one remesh per chunk for the whole step
+    TMap<FChunkKey, TArray<TPair<int32, uint8>>> PerChunk;
+    for (const VoxelBlockTicks::FChunkJob& Job : Jobs)
+    {
+        for (const VoxelBlockTicks::FWrite& W : Job.Writes)
+        {
+            int32 LX = 0, LZ = 0;
+            const FChunkKey Key = GlobalToChunkLocal(W.Cell.X, W.Cell.Z, LX, LZ);
+            const FVoxelChunkData* Data = FindLoadedData(Key);
+            const int32 Index = IndexFromXYZ(LX, W.Cell.Y, LZ);
+            if (!Data || Data->GetRawAtIndex(Index) != W.OldId) continue;
+
+            PerChunk.FindOrAdd(Key).Add({ Index, W.NewId });
+        }
+    }
+    if (PerChunk.Num() == 0) return;
+
+    TMap<FChunkKey, uint8> Remesh;
+    WriteEditsPerChunk(PerChunk, Remesh);
+    CommitEdit(/*bUndoable=*/false);
+    FlushEditRemesh(Remesh);
+}
+
+void AVoxelWorldManager::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
     // Save edits for all still-loaded chunks before we go away
     FlushAllDirtyChunks();
 
+    // Finish sidecar appends in order; loads still in flight will never pick up their deferred edits
+    for (TPair<FChunkKey, TFuture<void>>& P : SidecarWrites)
+    {
+        P.Value.Wait();
+    }
+    SidecarWrites.Reset();
+    for (const TPair<FChunkKey, TArray<TPair<int32, uint8>>>& P : SidecarQueued)
+    {
+        VoxelSaveSystem::AppendEdits(WorldSeed, P.Key, P.Value);
+    }
+    SidecarQueued.Reset();
+    for (const TPair<FChunkKey, TArray<TPair<int32, uint8>>>& P : DeferredEdits)
+    {
+        VoxelSaveSystem::AppendEdits(WorldSeed, P.Key, P.Value);
+    }
+    DeferredEdits.Reset();
+
+    // Every edit is in a chunk save now; the journal only exists to survive crashes
+    if (Journal)
+    {
+        Journal.Reset();
+        FVoxelEditJournal::Discard(WorldSeed);
+    }
+    JournaledChunks.Reset();
+    JournalRecords = 0;
+    UndoStack.Reset();
+    RedoStack.Reset();
+
     Super::EndPlay(EndPlayReason);
 }
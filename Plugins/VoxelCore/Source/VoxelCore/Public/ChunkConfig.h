@@ -1,9 +1,24 @@
 #pragma once
 
+#include "Runtime/Launch/Resources/Version.h"
+
 // Chunk size config - change these constants project-wide if needed.
 constexpr int32 CHUNK_SIZE_X = 16;
 constexpr int32 CHUNK_SIZE_Y = 128; // vertical axis
 constexpr int32 CHUNK_SIZE_Z = 16;
 constexpr int32 CHUNK_VOLUME = CHUNK_SIZE_X * CHUNK_SIZE_Y * CHUNK_SIZE_Z;
 
-constexpr int32 DEFAULT_WORLD_SEED = 1337;
\ No newline at end of file
+// Vertical mesh sections: edits only remesh/re-upload the 16-high slices they touch.
+constexpr int32 CHUNK_SECTION_HEIGHT = 16;
+constexpr int32 CHUNK_NUM_SECTIONS = CHUNK_SIZE_Y / CHUNK_SECTION_HEIGHT;
+constexpr uint8 CHUNK_ALL_SECTIONS = (uint8)((1u << CHUNK_NUM_SECTIONS) - 1);
+static_assert(CHUNK_SIZE_Y % CHUNK_SECTION_HEIGHT == 0 && CHUNK_NUM_SECTIONS <= 8, "Section mask is a uint8");
+
+constexpr int32 DEFAULT_WORLD_SEED = 1337;
+
+// Keep-capacity argument for TArray Pop/RemoveAt/SetNum: EAllowShrinking from 5.4, a bool before
+#if ENGINE_MAJOR_VERSION > 5 || (ENGINE_MAJOR_VERSION == 5 && ENGINE_MINOR_VERSION >= 4)
+#define VOXEL_NO_SHRINK EAllowShrinking::No
+#else
+#define VOXEL_NO_SHRINK false
+#endif
\ No newline at end of file
@@ -21,6 +21,13 @@ inline void XYZFromIndex(int32 Index, int32& OutX, int32& OutY, int32& OutZ)
 	OutX = Rem - (OutZ * CHUNK_SIZE_X);
 }
 
+// Integer floor division (rounds toward -inf, so negative world coords map correctly)
+inline int32 FloorDiv(int32 A, int32 B)
+{
+	const int32 Q = A / B;
+	return (A % B != 0 && ((A < 0) != (B < 0))) ? Q - 1 : Q;
+}
+
 // Simple chunk key (2D chunks: chunk X and chunk Z)
 struct FChunkKey
 {
@@ -39,6 +46,17 @@ struct FChunkKey
 };
 
 
+// Global voxel (X,Z) -> owning chunk key + local coords. Y is shared (chunks span full height).
+inline FChunkKey GlobalToChunkLocal(int32 GX, int32 GZ, int32& OutLX, int32& OutLZ)
+{
+	const int32 CX = FloorDiv(GX, CHUNK_SIZE_X);
+	const int32 CZ = FloorDiv(GZ, CHUNK_SIZE_Z);
+	OutLX = GX - CX * CHUNK_SIZE_X;
+	OutLZ = GZ - CZ * CHUNK_SIZE_Z;
+	return FChunkKey(CX, CZ);
+}
+
+
 // Hash function so we can use FChunkKey in TMap/TSet
 FORCEINLINE uint32 GetTypeHash(const FChunkKey& Key)
 {
@@ -0,0 +1,196 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "VoxelTypes.h"
+
+// Face directions in emit order. Voxel axes: X, Y (up), Z; world = (X, Z, Y).
+enum class EVoxelFace : uint8
+{
+    PosX = 0,
+    NegX,
+    PosZ, // north (world +Y)
+    NegZ, // south (world -Y)
+    PosY, // top (world +Z)
+    NegY, // bottom
+    Count
+};
+
+// Which mesh section / material a block renders into. Material slot == layer.
+enum class EVoxelRenderLayer : uint8
+{
+    Opaque,
+    Cutout,      // masked, depth-writing (leaves, glass)
+    Translucent, // sorted back to front, no collision (water)
+    Count
+};
+
+constexpr int32 VOXEL_NUM_RENDER_LAYERS = (int32)EVoxelRenderLayer::Count;
+
+// Atlas layout (adjust to your real atlas)
+constexpr int32 VOXEL_ATLAS_TILES_X = 4;
+constexpr int32 VOXEL_ATLAS_TILES_Y = 1;
+constexpr int32 VOXEL_ATLAS_TILE_PX = 64;
+constexpr int32 VOXEL_ATLAS_PAD_PX = 2; // inset (gutter) against bleeding; if you still see seams at distance, try 3-4
+constexpr int32 VOXEL_ATLAS_NUM_TILES = VOXEL_ATLAS_TILES_X * VOXEL_ATLAS_TILES_Y;
+
+// Inset UV rectangle of one atlas tile.
+struct FVoxelAtlasRect
+{
+    float U0 = 0.f;
+    float V0 = 0.f;
+    float U1 = 0.f;
+    float V1 = 0.f;
+};
+
+// Static render/physics properties of one block id, per face where it matters.
+struct FVoxelBlockDef
+{
+    bool bSolid = false;       // occupies its cell
+    bool bTransparent = true;  // neighbouring faces stay visible through it
+    bool bCullSelf = false;    // faces between two blocks of this id are hidden (water, glass)
+    EVoxelRenderLayer Layer = EVoxelRenderLayer::Opaque;
+    uint8  FaceTile[(int32)EVoxelFace::Count] = {};
+    uint32 FaceColor[(int32)EVoxelFace::Count] = {}; // FColor packed 0xAARRGGBB
+    uint8  Emission = 0;       // block light it gives off, 0-15
+    uint8  FluidLevel = 0;     // 8 = source, 1-7 = flowing, 0 = not a fluid
+    bool   bRandomTick = false; // picked by the random-tick sampler (VoxelBlockTicks)
+    uint8  NeighborTickDelay = 0; // >0: scheduled tick this many block ticks after the voxel above or below changes
+    bool   bFalls = false;     // drops down its column when nothing holds it up (sand, gravel)
+};
+
+/**
+ * Block registry compiled into constant tables. The mesher only indexes these
+ * (block id x face), so adding a block or giving it per-face textures is a table edit.
+ */
+namespace VoxelBlocks
+{
+    constexpr int32 NumIds = 256; // every uint8 id has an entry
+
+    struct FTables
+    {
+        FVoxelBlockDef Blocks[NumIds];
+        FVoxelAtlasRect Tiles[VOXEL_ATLAS_NUM_TILES];
+    };
+
+    namespace Detail
+    {
+        constexpr FVoxelBlockDef Opaque(uint8 SideTile, uint8 TopTile, uint8 BottomTile,
+            uint32 SideColor, uint32 TopColor, uint32 BottomColor)
+        {
+            FVoxelBlockDef Def{};
+            Def.bSolid = true;
+            Def.bTransparent = false;
+            Def.Layer = EVoxelRenderLayer::Opaque;
+            for (int32 F = 0; F < (int32)EVoxelFace::Count; ++F)
+            {
+                Def.FaceTile[F] = SideTile;
+                Def.FaceColor[F] = SideColor;
+            }
+            Def.FaceTile[(int32)EVoxelFace::PosY] = TopTile;
+            Def.FaceColor[(int32)EVoxelFace::PosY] = TopColor;
+            Def.FaceTile[(int32)EVoxelFace::NegY] = BottomTile;
+            Def.FaceColor[(int32)EVoxelFace::NegY] = BottomColor;
+            return Def;
+        }
+
+        constexpr FVoxelBlockDef Opaque(uint8 Tile, uint32 Color)
+        {
+            return Opaque(Tile, Tile, Tile, Color, Color, Color);
+        }
+
+        constexpr FVoxelBlockDef SeeThrough(EVoxelRenderLayer Layer, bool bSolid, bool bCullSelf, uint8 Tile, uint32 Color)
+        {
+            FVoxelBlockDef Def = Opaque(Tile, Color);
+            Def.bSolid = bSolid;
+            Def.bTransparent = true;
+            Def.bCullSelf = bCullSelf;
+            Def.Layer = Layer;
+            return Def;
+        }
+
+        constexpr FTables Build()
+        {
+            constexpr uint32 White = 0xFFFFFFFF;
+            constexpr uint32 GrassColor = 0xFF19CC19;
+            constexpr uint32 DirtColor = 0xFF734721;
+
+            FTables T{};
+
+            // Tile rects, shrunk by the gutter so we don't touch the outer border
+            constexpr float TileW = 1.0f / float(VOXEL_ATLAS_TILES_X);
+            constexpr float TileH = 1.0f / float(VOXEL_ATLAS_TILES_Y);
+            constexpr float PadU = float(VOXEL_ATLAS_PAD_PX) / float(VOXEL_ATLAS_TILES_X * VOXEL_ATLAS_TILE_PX);
+            constexpr float PadV = float(VOXEL_ATLAS_PAD_PX) / float(VOXEL_ATLAS_TILES_Y * VOXEL_ATLAS_TILE_PX);
+            for (int32 Tile = 0; Tile < VOXEL_ATLAS_NUM_TILES; ++Tile)
+            {
+                const int32 SlotX = Tile % VOXEL_ATLAS_TILES_X;
+                const int32 SlotY = Tile / VOXEL_ATLAS_TILES_X;
+                T.Tiles[Tile].U0 = SlotX * TileW + PadU;
+                T.Tiles[Tile].V0 = SlotY * TileH + PadV;
+                T.Tiles[Tile].U1 = (SlotX + 1) * TileW - PadU;
+                T.Tiles[Tile].V1 = (SlotY + 1) * TileH - PadV;
+            }
+
+            // Unlisted ids render as plain opaque cubes on the catch-all tile
+            for (int32 Id = 0; Id < NumIds; ++Id)
+            {
+                T.Blocks[Id] = Opaque(3, White);
+            }
+
+            T.Blocks[(uint8)EBlockId::Air] = FVoxelBlockDef{};
+
+            // Atlas: 0 grass, 1 dirt, 2 stone, 3 everything else. Grass bottoms show dirt.
+            T.Blocks[(uint8)EBlockId::Grass] = Opaque(0, 0, 1, GrassColor, GrassColor, DirtColor);
+            T.Blocks[(uint8)EBlockId::Grass].bRandomTick = true;
+            T.Blocks[(uint8)EBlockId::Grass].NeighborTickDelay = 20;
+            T.Blocks[(uint8)EBlockId::Dirt] = Opaque(1, DirtColor);
+            T.Blocks[(uint8)EBlockId::Stone] = Opaque(2, 0xFF7F7F7F);
+            T.Blocks[(uint8)EBlockId::Log] = Opaque(3, 0xFF593819);
+            T.Blocks[(uint8)EBlockId::CoalOre] = Opaque(3, 0xFF333333);
+            T.Blocks[(uint8)EBlockId::Sand].bFalls = true;
+            T.Blocks[(uint8)EBlockId::Gravel] = Opaque(2, 0xFF8C857B);
+            T.Blocks[(uint8)EBlockId::Gravel].bFalls = true;
+            T.Blocks[(uint8)EBlockId::Lamp] = Opaque(3, 0xFFFFD890);
+            T.Blocks[(uint8)EBlockId::Lamp].Emission = 15;
+
+            // Alpha is owned by AO in the vertex color, so translucency comes from the material
+            T.Blocks[(uint8)EBlockId::Leaves] = SeeThrough(EVoxelRenderLayer::Cutout, true, false, 3, 0xFF0C7F14);
+            T.Blocks[(uint8)EBlockId::Glass] = SeeThrough(EVoxelRenderLayer::Cutout, true, true, 3, 0xFFE0F0FF);
+            T.Blocks[(uint8)EBlockId::Water] = SeeThrough(EVoxelRenderLayer::Translucent, false, true, 3, 0xFF2A5FD8);
+            T.Blocks[(uint8)EBlockId::Water].FluidLevel = 8;
+            for (int32 Level = 1; Level <= 7; ++Level)
+            {
+                const uint8 Id = (uint8)EBlockId::WaterFlow1 + Level - 1;
+                T.Blocks[Id] = SeeThrough(EVoxelRenderLayer::Translucent, false, true, 3, 0xFF2A5FD8);
+                T.Blocks[Id].FluidLevel = (uint8)Level;
+            }
+            return T;
+        }
+    }
+
+    inline constexpr FTables Tables = Detail::Build();
+
+    FORCEINLINE const FVoxelBlockDef& Get(uint8 Id) { return Tables.Blocks[Id]; }
+    FORCEINLINE const FVoxelBlockDef& Get(EBlockId Id) { return Tables.Blocks[(uint8)Id]; }
+
+    FORCEINLINE const FVoxelAtlasRect& GetTileRect(uint8 Tile) { return Tables.Tiles[Tile % VOXEL_ATLAS_NUM_TILES]; }
+
+    FORCEINLINE FColor GetFaceColor(uint8 Id, int32 Face) { return FColor(Tables.Blocks[Id].FaceColor[Face]); }
+
+    // Face of Id toward NeighborId: hidden behind anything opaque, between same-id blocks that
+    // cull themselves and between any two fluid levels. Solids next to water keep their face;
+    // the water face toward them is hidden.
+    FORCEINLINE bool IsFaceVisible(uint8 Id, uint8 NeighborId)
+    {
+        const FVoxelBlockDef& N = Tables.Blocks[NeighborId];
+        if (!N.bTransparent) return false;
+        if (N.FluidLevel != 0 && Tables.Blocks[Id].FluidLevel != 0) return false;
+        return !(NeighborId == Id && N.bCullSelf);
+    }
+
+    // Cells a falling block drops through: air and every fluid level, sources included
+    FORCEINLINE bool IsFallThrough(uint8 Id)
+    {
+        return Id == (uint8)EBlockId::Air || Tables.Blocks[Id].FluidLevel != 0;
+    }
+}
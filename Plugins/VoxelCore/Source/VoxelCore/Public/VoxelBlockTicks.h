@@ -0,0 +1,77 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ChunkHelpers.h"         // FChunkKey
+
+struct FVoxelChunkData;
+
+/** Pending scheduled tick of one voxel; kept in a per-chunk min-heap on Due. */
+struct FVoxelScheduledTick
+{
+    uint64 Due = 0;  // block-tick count it fires at
+    int32 Index = 0; // flat voxel index in the chunk
+
+    bool operator<(const FVoxelScheduledTick& Other) const { return Due < Other.Due; }
+};
+
+/** One chunk's scheduled ticks: the min-heap plus the (Due, Index) pairs in it, so scheduling a
+ *  voxel again for a tick it already has is a no-op instead of a second heap entry. */
+struct FVoxelTickQueue
+{
+    TArray<FVoxelScheduledTick> Heap;
+    TSet<uint64> Queued;
+
+    static uint64 Tag(const FVoxelScheduledTick& T) { return (T.Due << 15) | (uint64)T.Index; } // Index < 2^15
+
+    void Push(const FVoxelScheduledTick& T)
+    {
+        bool bAlreadyQueued = false;
+        Queued.Add(Tag(T), &bAlreadyQueued);
+        if (!bAlreadyQueued) Heap.HeapPush(T);
+    }
+
+    void Pop(FVoxelScheduledTick& Out)
+    {
+        Heap.HeapPop(Out, VOXEL_NO_SHRINK);
+        Queued.Remove(Tag(Out));
+    }
+};
+
+/**
+ * Per-block behaviour driven by AVoxelWorldManager's block-tick step: scheduled ticks (a voxel
+ * asked to be looked at again after N block ticks) and random ticks (a few random voxels per
+ * section that holds random-ticking blocks, see FVoxelBlockDef::bRandomTick).
+ * A step runs one job per chunk in parallel. Jobs only read voxel data; the edits they return
+ * are applied in one batch on the game thread, and those writes schedule the ticks of the
+ * blocks around them (FVoxelBlockDef::NeighborTickDelay) like any other edit.
+ */
+namespace VoxelBlockTicks
+{
+    struct FWrite
+    {
+        FIntVector Cell;  // global voxel coords (X, Y up, Z)
+        uint8 OldId = 0;  // id the job read; the write is dropped if the cell changed since
+        uint8 NewId = 0;
+    };
+
+    // Loaded chunk for a key, or null (read-only, called from the job threads)
+    using FLookup = TFunctionRef<const FVoxelChunkData*(const FChunkKey&)>;
+
+    struct FChunkJob
+    {
+        FChunkKey Key;
+        const FVoxelChunkData* Data = nullptr;
+        TArray<int32> Scheduled;  // due voxel indices
+        int32 RandomPerSection = 0;
+        int32 Seed = 0;
+
+        // Out
+        TArray<FWrite> Writes;
+    };
+
+    /** Sections of Data holding at least one random-ticking block (bit per section). Full scan; run at load. */
+    uint8 ScanRandomTickSections(const FVoxelChunkData& Data);
+
+    /** Run one chunk's scheduled and random ticks (any thread). */
+    void RunChunk(FChunkJob& Job, FLookup Lookup);
+}
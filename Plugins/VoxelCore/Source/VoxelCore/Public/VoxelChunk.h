@@ -17,6 +17,22 @@ struct FVoxelChunkData
     // Deltas (persisted): localIndex -> blockId (16-bit for future-proofing).
     TMap<int32, uint16> ModifiedBlocks;
 
+    // True when Blocks came from a saved full snapshot rather than the generator.
+    // Such chunks no longer have a generated base, so saves must write full contents.
+    bool bSnapshotBase = false;
+
+    // Edits from the chunk's .vce sidecar were merged at load; the next save folds them in.
+    bool bMergedSidecar = false;
+
+    // Contents differ from the save file even without deltas (e.g. materialized at load); save on unload.
+    bool bUnsaved = false;
+
+    // Light per voxel (VoxelLight: sky << 4 | block). Empty until lit; derived, never saved.
+    TArray<uint8> Light;
+
+    // Bit per section that may hold random-ticking blocks (set on load and on writes, never cleared).
+    uint8 RandomTickSections = 0;
+
     // Ctors
     FVoxelChunkData() = default;
 
@@ -81,8 +97,42 @@ struct FVoxelChunkData
         }
     }
 
+    // Read by flat index with delta fallback (no bounds check beyond the base array).
+    FORCEINLINE uint8 GetRawAtIndex(int32 Index) const
+    {
+        if (const uint16* Ptr = ModifiedBlocks.Find(Index))
+        {
+            return static_cast<uint8>(*Ptr);
+        }
+        return Blocks.IsValidIndex(Index) ? Blocks[Index] : 0;
+    }
+
+    // Delta write by flat index (no XYZ round trip). Same rules as SetBlockAt.
+    FORCEINLINE void SetDeltaAtIndex(int32 Index, uint8 Raw)
+    {
+        if (!Blocks.IsValidIndex(Index)) return;
+        if (Blocks[Index] == Raw)
+        {
+            ModifiedBlocks.Remove(Index);
+        }
+        else
+        {
+            ModifiedBlocks.Add(Index, static_cast<uint16>(Raw));
+        }
+    }
+
     FORCEINLINE void ClearDeltas()
     {
         ModifiedBlocks.Empty();
     }
+
+    // Base + deltas as one dense array (what the player actually sees).
+    void GetFlattened(TArray<uint8>& Out) const
+    {
+        Out = Blocks;
+        for (const TPair<int32, uint16>& P : ModifiedBlocks)
+        {
+            if (Out.IsValidIndex(P.Key)) Out[P.Key] = static_cast<uint8>(P.Value);
+        }
+    }
 };
@@ -1,7 +1,8 @@
 #pragma once
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
-#include "ProceduralMeshComponent.h"
+#include "VoxelChunkMeshComponent.h"
+#include "VoxelMesher.h"            // VOXEL_NUM_MESH_GROUPS
 #include "VoxelChunk.h" // <-- add this include for FVoxelChunkData
 #include "VoxelChunkActor.generated.h"
 
@@ -13,19 +14,22 @@ public:
     AVoxelChunkActor();
 
     UPROPERTY(VisibleAnywhere)
-    UProceduralMeshComponent* ProcMesh;
+    UVoxelChunkMeshComponent* ChunkMesh;
 
     UPROPERTY(EditAnywhere, Category = "Voxel")
     float BlockSize = 100.f;
 
-    // Existing:
-    void BuildFromBuffers(const TArray<FVector>& Vertices,
-        const TArray<int32>& Triangles,
-        const TArray<FVector>& Normals,
-        const TArray<FVector2D>& UVs,
-        const TArray<FLinearColor>& Colors,
-        const TArray<FProcMeshTangent>& Tangents,
-        UMaterialInterface* UseMaterial);
+    // Uploads worker-built buffers as sections 0..N-1, all drawn with UseMaterial. Buffers come
+    // back empty with reusable storage.
+    void BuildFromBuffers(TArrayView<FVoxelMeshSectionBuffers> Buffers, UMaterialInterface* UseMaterial, bool bCollision = true);
+
+    // Uploads the mesh groups (component section == VoxelMeshGroup(Section, Layer)) of the vertical
+    // sections in SectionMask (only the layers in LayerMask); the rest stay as they are. One material
+    // slot per render layer; null materials keep the slot's current one. The translucent layer
+    // never collides.
+    void BuildFromSections(FVoxelMeshSectionBuffers (&Groups)[VOXEL_NUM_MESH_GROUPS], uint8 SectionMask,
+        UMaterialInterface* const (&Materials)[VOXEL_NUM_RENDER_LAYERS], bool bCollision = true,
+        uint8 LayerMask = (1u << VOXEL_NUM_RENDER_LAYERS) - 1);
 
     // NEW: used by VoxelChunkSpawnCommand.cpp
     void BuildFromChunk(const FVoxelChunkData& Chunk, float InBlockSize, UMaterialInterface* UseMaterial);
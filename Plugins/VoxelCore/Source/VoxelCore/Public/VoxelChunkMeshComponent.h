@@ -0,0 +1,97 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Components/MeshComponent.h"
+#include "Interfaces/Interface_CollisionDataProvider.h"
+#include "VoxelMeshBuffers.h"
+#include "VoxelChunkMeshComponent.generated.h"
+
+class FVoxelChunkRenderSection;
+class UBodySetup;
+
+/**
+ * Lightweight chunk mesh component. Takes worker-built section buffers by move and fills its
+ * vertex/index buffers directly from them (no ProcMesh section copy, no dynamic-vertex copy,
+ * bounds come precomputed from the worker). GPU sections are owned here and shared with the
+ * scene proxy, so updating one section only uploads that section.
+ */
+UCLASS(ClassGroup = (Rendering), meta = (BlueprintSpawnableComponent))
+class UVoxelChunkMeshComponent : public UMeshComponent, public IInterface_CollisionDataProvider
+{
+    GENERATED_BODY()
+public:
+    UVoxelChunkMeshComponent(const FObjectInitializer& ObjectInitializer);
+
+    /** Cook collision on a background thread (game worlds only). */
+    UPROPERTY(EditAnywhere, Category = "Voxel")
+    bool bUseAsyncCooking = true;
+
+    /** Replace one section. bCollision keeps positions/indices for cooking. On return Buffers is
+     *  empty but holds reusable storage (the previous collision arrays, possibly empty, are
+     *  swapped back out), so callers can return it to a FVoxelMeshBufferPool, which pools
+     *  those two arrays separately from the rest. */
+    void SetSection(int32 SectionIndex, FVoxelMeshSectionBuffers& Buffers, bool bCollision = true);
+
+    /** Replace the sections whose bit is set in UpdateMask (Buffers[i] is section i) together:
+     *  one bounds update and at most one collision cook. Untouched sections keep their GPU
+     *  buffers. Bit i of CollisionMask enables collision for section i. */
+    void SetSections(TArrayView<FVoxelMeshSectionBuffers> Buffers, uint32 UpdateMask, uint32 CollisionMask);
+
+    /** When > 0, section i renders with material slot (i % NumMaterialSlots), so many sections
+     *  can share a few materials. 0 = one slot per section. */
+    void SetNumMaterialSlots(int32 InNumSlots) { NumMaterialSlots = FMath::Max(0, InNumSlots); }
+    int32 GetMaterialSlotForSection(int32 SectionIndex) const { return NumMaterialSlots > 0 ? SectionIndex % NumMaterialSlots : SectionIndex; }
+
+    void ClearSection(int32 SectionIndex);
+
+    /** Hand every section's kept collision arrays to Pool, e.g. right before the owner is
+     *  destroyed. Leaves the current physics body as it is. */
+    void ReleaseCollisionStorage(FVoxelMeshBufferPool& Pool);
+
+    /** Stop (or resume) drawing one section. Its GPU buffers and collision are kept. */
+    void SetSectionVisible(int32 SectionIndex, bool bVisible);
+    void ClearAllSections();
+
+    int32 GetNumSections() const { return Sections.Num(); }
+
+    //~ UPrimitiveComponent
+    virtual FPrimitiveSceneProxy* CreateSceneProxy() override;
+    virtual UBodySetup* GetBodySetup() override;
+    virtual int32 GetNumMaterials() const override;
+
+    //~ USceneComponent
+    virtual FBoxSphereBounds CalcBounds(const FTransform& LocalToWorld) const override;
+
+    //~ IInterface_CollisionDataProvider
+    virtual bool GetPhysicsTriMeshData(struct FTriMeshCollisionData* CollisionData, bool InUseAllTriData) override;
+    virtual bool ContainsPhysicsTriMeshData(bool InUseAllTriData) const override;
+    virtual bool WantsNegXTriMesh() override { return false; }
+
+private:
+    struct FSectionState
+    {
+        TSharedPtr<FVoxelChunkRenderSection, ESPMode::ThreadSafe> Render;
+        TArray<FVector3f> CollisionPositions;
+        TArray<uint32>    CollisionIndices;
+        FBox3f Bounds = FBox3f(ForceInit);
+        bool bVisible = true;
+    };
+
+    TArray<FSectionState> Sections;
+    FBox LocalBounds = FBox(ForceInit);
+    int32 NumMaterialSlots = 0;
+
+    UPROPERTY(Transient)
+    TObjectPtr<UBodySetup> BodySetup;
+
+    // Body setups being cooked asynchronously, oldest first
+    UPROPERTY(Transient)
+    TArray<TObjectPtr<UBodySetup>> AsyncBodySetupQueue;
+
+    // Swap in one section's render/collision data; true if collision has to be re-cooked
+    bool ReplaceSection(int32 SectionIndex, FVoxelMeshSectionBuffers& Buffers, bool bCollision);
+
+    void UpdateLocalBounds();
+    void UpdateCollision();
+    UBodySetup* CreateBodySetupHelper();
+    void FinishPhysicsAsyncCook(bool bSuccess, UBodySetup* FinishedBodySetup);
+};
@@ -0,0 +1,75 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/Runnable.h"
+#include "Containers/Queue.h"
+#include "ChunkHelpers.h"   // FChunkKey
+
+class FRunnableThread;
+class FEvent;
+
+/** One voxel write: flat index into Key's chunk, id before and after. */
+struct FVoxelEditRecord
+{
+    FChunkKey Key;
+    int32 Index = 0;
+    uint8 OldId = 0;
+    uint8 NewId = 0;
+};
+
+/** Records written by one edit call (a placed block, a filled sphere), undone/redone as a unit. */
+struct FVoxelEditTransaction
+{
+    uint32 Id = 0;
+    TArray<FVoxelEditRecord> Records;
+};
+
+/** A record as stored in the journal file. */
+struct FVoxelJournalEntry
+{
+    FVoxelEditRecord Edit;
+    uint32 Transaction = 0;
+    int64 Timestamp = 0; // FDateTime ticks (UTC)
+};
+
+/**
+ * Append-only edit log (Saved/Voxel/Seed_N/Edits.vcj) covering edits not yet in chunk saves.
+ * Append only queues the record; a background thread writes and flushes batches, so the game
+ * thread never touches the file. Replaying the entries in order onto saved chunks reproduces
+ * the latest state, so a crash loses at most the last unflushed batch.
+ */
+class FVoxelEditJournal : public FRunnable
+{
+public:
+    explicit FVoxelEditJournal(int32 InSeed);
+    virtual ~FVoxelEditJournal() override; // writes everything queued, then closes
+
+    // Queues one transaction's records (a single copy). Game thread only (single producer).
+    void Append(TConstArrayView<FVoxelEditRecord> Edits, uint32 Transaction);
+
+    // Entries of an existing journal, in write order. A torn tail record is dropped.
+    static bool Load(int32 Seed, TArray<FVoxelJournalEntry>& Out);
+
+    // Deletes the journal; only call when no writer for Seed is alive.
+    static void Discard(int32 Seed);
+
+    // FRunnable
+    virtual uint32 Run() override;
+    virtual void Stop() override;
+
+private:
+    struct FBatch
+    {
+        uint32 Transaction = 0;
+        int64 Timestamp = 0;
+        TArray<FVoxelEditRecord> Records;
+    };
+
+    void WritePending(class IFileHandle* File, TArray<uint8>& Scratch);
+
+    int32 Seed = 0;
+    TQueue<FBatch, EQueueMode::Spsc> Queue;
+    FEvent* WakeEvent = nullptr;
+    FRunnableThread* Thread = nullptr;
+    TAtomic<bool> bStopping{ false };
+};
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ChunkHelpers.h"
+#include "VoxelMeshBuffers.h"
+
+struct FVoxelGeneratorConfig;
+
+/** Far-field tile parameters. A tile covers TileChunks x TileChunks chunks. */
+struct FVoxelFarTileSettings
+{
+    int32 TileChunks = 4;
+    int32 StepVoxels = 4;      // heightmap sample spacing; rounded down to divide the chunk width
+    float BlockSize = 100.f;
+    float DropUU = 50.f;       // sink below the voxel surface so real chunks always win
+};
+
+namespace VoxelFarField
+{
+    // Tile containing a chunk (floor division, so negative chunks map correctly).
+    FChunkKey ChunkToTile(const FChunkKey& Chunk, int32 TileChunks);
+
+    // Heightmap mesh for one tile, relative to the tile's first chunk origin, as one section per
+    // chunk (index dx + dz * TileChunks) so each can be hidden once its real chunk is meshed.
+    // Heights come from saved column summaries where a chunk has been saved, else from the
+    // generator's base terrain. Costs one noise sample per StepVoxels^2 columns; no chunk
+    // generation or voxel meshing. Out must hold TileChunks^2 buffers.
+    void BuildTileMesh(const FVoxelGeneratorConfig& Config, const FChunkKey& Tile,
+        const FVoxelFarTileSettings& Settings, TArrayView<FVoxelMeshSectionBuffers> Out);
+}
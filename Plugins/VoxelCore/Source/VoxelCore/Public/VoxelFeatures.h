@@ -0,0 +1,111 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ChunkConfig.h"
+#include "ChunkHelpers.h"
+#include "VoxelTypes.h"
+#include "Misc/ScopeLock.h"
+
+struct FVoxelChunkData;
+class FVoxelGenerator;
+
+// Features are planned per region of FEATURE_REGION_CHUNKS x FEATURE_REGION_CHUNKS chunks.
+constexpr int32 FEATURE_REGION_CHUNKS = 4;
+
+// Max distance (voxels, XZ) a feature may reach past its anchor column. Chunks look this far
+// into neighbouring regions so features spill across chunk/region borders.
+constexpr int32 FEATURE_MAX_SPILL = 4;
+
+enum class EVoxelFeatureType : uint8
+{
+    Tree,
+    OreVein,
+    Boulder
+};
+
+// What a feature block is allowed to overwrite when stamped.
+enum class EVoxelFeatureReplace : uint8
+{
+    AirOnly,    // leaves, boulders: never carve into terrain
+    StoneOnly,  // ore: only inside stone
+    AirOrLeaves // trunks: may push through another tree's canopy
+};
+
+/** One block write in global voxel space (X,Z horizontal, Y vertical). */
+struct FVoxelFeatureBlock
+{
+    FIntVector Pos;
+    uint8 Id = 0;
+    EVoxelFeatureReplace Replace = EVoxelFeatureReplace::AirOnly;
+};
+
+struct FVoxelFeature
+{
+    EVoxelFeatureType Type = EVoxelFeatureType::Tree;
+    FIntVector Min; // inclusive global bounds
+    FIntVector Max;
+    TArray<FVoxelFeatureBlock> Blocks;
+};
+
+/** All features anchored inside one region, in deterministic placement order. */
+struct FVoxelFeatureRegion
+{
+    FIntPoint Coord;
+    TArray<FVoxelFeature> Features;
+};
+
+/**
+ * Thread-safe region cache shared by worker jobs. Regions are computed once and then only
+ * read, so a chunk only pays for stamping. Oldest regions are evicted past MaxRegions.
+ */
+class FVoxelFeatureCache
+{
+public:
+    explicit FVoxelFeatureCache(uint32 InConfigHash, int32 InMaxRegions = 256)
+        : ConfigHash(InConfigHash), MaxRegions(InMaxRegions) {}
+
+    // Generator config fingerprint the cached plans were built with.
+    uint32 GetConfigHash() const { return ConfigHash; }
+
+    TSharedPtr<const FVoxelFeatureRegion> Find(const FIntPoint& Region) const
+    {
+        FScopeLock Lock(&Mutex);
+        const TSharedPtr<const FVoxelFeatureRegion>* Found = Regions.Find(Region);
+        return Found ? *Found : nullptr;
+    }
+
+    // Returns the cached instance (another worker may have raced us to the same region).
+    TSharedPtr<const FVoxelFeatureRegion> Add(const TSharedPtr<const FVoxelFeatureRegion>& Region)
+    {
+        FScopeLock Lock(&Mutex);
+        if (const TSharedPtr<const FVoxelFeatureRegion>* Existing = Regions.Find(Region->Coord))
+        {
+            return *Existing;
+        }
+        while (Order.Num() >= MaxRegions && Order.Num() > 0)
+        {
+            Regions.Remove(Order[0]);
+            Order.RemoveAt(0, 1, VOXEL_NO_SHRINK);
+        }
+        Regions.Add(Region->Coord, Region);
+        Order.Add(Region->Coord);
+        return Region;
+    }
+
+private:
+    uint32 ConfigHash;
+    int32 MaxRegions;
+    mutable FCriticalSection Mutex;
+    TMap<FIntPoint, TSharedPtr<const FVoxelFeatureRegion>> Regions;
+    TArray<FIntPoint> Order; // insertion order for eviction
+};
+
+namespace VoxelFeatures
+{
+    // Plan every feature anchored in Region. Pure function of generator seed/params + region coords.
+    TSharedPtr<const FVoxelFeatureRegion> BuildRegion(const FVoxelGenerator& Gen, const FIntPoint& Region);
+
+    // Stamp the part of every nearby feature that overlaps this chunk into its base Blocks.
+    // Cache may be null (features are then planned on the fly).
+    void DecorateChunk(const FVoxelGenerator& Gen, FVoxelFeatureCache* Cache, const FChunkKey& Key, FVoxelChunkData& Chunk);
+}
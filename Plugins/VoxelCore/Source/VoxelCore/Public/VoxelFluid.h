@@ -0,0 +1,52 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ChunkHelpers.h"         // FChunkKey
+#include "VoxelBlockRegistry.h"
+
+struct FVoxelChunkData;
+
+/**
+ * Cellular water. Each step recomputes only the cells in the active set, as a pure function of
+ * their neighbours' ids, so a step can run on a worker against a copy of the chunks around those
+ * cells and the writes it returns are applied in one batch on the game thread. A cell that
+ * changes wakes its six neighbours and the four side cells above it (which read it as the drop
+ * under their side neighbour) for the next step; anything else goes idle.
+ *
+ * Rules: sources (Water) never change. Air or flowing water under any fluid becomes level 7
+ * (falling); otherwise it takes one less than the strongest side neighbour that rests on
+ * something it cannot fall through, and drains to air at 0.
+ */
+namespace VoxelFluid
+{
+    constexpr uint8 SourceLevel = 8;
+
+    FORCEINLINE uint8 LevelOf(uint8 Id) { return VoxelBlocks::Get(Id).FluidLevel; }
+    FORCEINLINE bool IsFluid(uint8 Id) { return LevelOf(Id) != 0; }
+
+    // Cells flowing water may move into (and that do not hold it up)
+    FORCEINLINE bool IsReplaceable(uint8 Id) { return Id == (uint8)EBlockId::Air || (IsFluid(Id) && LevelOf(Id) < SourceLevel); }
+
+    FORCEINLINE uint8 FlowId(uint8 Level) { return Level == 0 ? (uint8)EBlockId::Air : (uint8)EBlockId::WaterFlow1 + Level - 1; }
+
+    struct FWrite
+    {
+        FIntVector Cell;  // global voxel coords (X, Y up, Z)
+        uint8 OldId = 0;  // id the step read; the write is dropped if the cell changed since
+        uint8 NewId = 0;
+    };
+
+    struct FStep
+    {
+        // In: cells to update and dense id copies (CHUNK_VOLUME each) of the loaded chunks around
+        // them, taken on the game thread; missing chunks read as solid
+        TArray<FIntVector> Cells;
+        TMap<FChunkKey, TArray<uint8>> Chunks;
+
+        // Out
+        TArray<FWrite> Writes;
+    };
+
+    /** Run one step (any thread). Fills Step.Writes. */
+    void Run(FStep& Step);
+}
@@ -6,19 +6,65 @@
 #include "VoxelChunk.h"
 #include "FastNoiseLite.h"
 
+class FVoxelFeatureCache;
+
+// Bump whenever generation/feature code changes output for the same parameters.
+// Part of the config fingerprint, so saves made against older output get materialized.
+constexpr uint32 VOXEL_GENERATOR_VERSION = 1;
+
+/**
+ * Everything that determines base terrain. Saved deltas are only valid against the base
+ * produced by the exact same config, so saves store it (and its hash) in their header.
+ */
+struct FVoxelGeneratorConfig
+{
+    int32  Seed = DEFAULT_WORLD_SEED;
+    float  HeightScale = static_cast<float>(CHUNK_SIZE_Y) * 0.6f;
+    float  HeightOffset = static_cast<float>(CHUNK_SIZE_Y) * 0.2f;
+    float  NoiseFrequency = 0.05f;
+    uint32 GeneratorVersion = VOXEL_GENERATOR_VERSION;
+
+    /** Stable fingerprint (hashes fields individually, not padding). */
+    uint32 GetHash() const
+    {
+        uint32 H = FCrc::MemCrc32(&Seed, sizeof(Seed));
+        H = FCrc::MemCrc32(&HeightScale, sizeof(HeightScale), H);
+        H = FCrc::MemCrc32(&HeightOffset, sizeof(HeightOffset), H);
+        H = FCrc::MemCrc32(&NoiseFrequency, sizeof(NoiseFrequency), H);
+        H = FCrc::MemCrc32(&GeneratorVersion, sizeof(GeneratorVersion), H);
+        return H;
+    }
+};
+
 /**
  * Deterministic chunk generator using FastNoiseLite.
  * - Produces a base terrain: stone deep, dirt a few layers, grass on top, air above.
  * - Deterministic based on seed + chunk coords.
+ * - GenerateChunk adds the feature pass (trees, ores, boulders) on top of the base terrain.
  */
 class FVoxelGenerator
 {
 public:
     FVoxelGenerator(int32 InSeed = DEFAULT_WORLD_SEED);
+    explicit FVoxelGenerator(const FVoxelGeneratorConfig& Config);
 
     /** Generate base chunk contents into OutChunk. Does not apply deltas. */
     void GenerateBaseChunk(const FChunkKey& Key, FVoxelChunkData& OutChunk);
 
+    /** Base terrain + feature placement. This is the "base" that saved deltas are relative to. */
+    void GenerateChunk(const FChunkKey& Key, FVoxelChunkData& OutChunk);
+
+    /** Surface height (top solid Y) of a global voxel column. Pure function of seed + parameters. */
+    int32 GetColumnTopY(int32 WorldX, int32 WorldZ) const;
+
+    int32 GetSeed() const { return Seed; }
+
+    /** Current parameters as a config (fingerprint source for saves/caches). */
+    FVoxelGeneratorConfig GetConfig() const;
+
+    /** Optional shared cache for per-region features (thread-safe, shared across worker jobs). */
+    void SetFeatureCache(TSharedPtr<FVoxelFeatureCache> InCache) { FeatureCache = MoveTemp(InCache); }
+
     /** Generator parameters (tweakable) */
     void SetHeightScale(float InScale) { HeightScale = InScale; }
     void SetHeightOffset(float InOffset) { HeightOffset = InOffset; }
@@ -31,6 +77,8 @@ private:
     float HeightOffset;   // additive offset
     float NoiseFrequency; // frequency scale for noise inputs
 
+    TSharedPtr<FVoxelFeatureCache> FeatureCache;
+
     FORCEINLINE int32 WorldHeightFromNoise(float NoiseValue) const
     {
         // noise expected in [-1,1]. Map to [0, CHUNK_SIZE_Y-1]
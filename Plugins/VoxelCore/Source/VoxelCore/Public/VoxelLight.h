@@ -0,0 +1,44 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "ChunkHelpers.h"   // FChunkKey
+
+struct FVoxelChunkData;
+struct FVoxelChunkNeighbors;
+
+/**
+ * Per-voxel light, one byte per cell in FVoxelChunkData::Light: sky light in the high nibble,
+ * block light in the low one, 0-15 each. Light passes through transparent blocks and loses one
+ * level per step, except sky light going straight down through air, which stays at 15.
+ * Chunks are lit by a full flood fill on the worker that loads them; edits and newly loaded
+ * neighbours are patched incrementally on the game thread across chunk borders.
+ */
+namespace VoxelLight
+{
+    constexpr uint8 MaxLevel = 15;
+    constexpr uint8 FullSky = MaxLevel << 4;
+
+    FORCEINLINE uint8 Sky(uint8 Light) { return Light >> 4; }
+    FORCEINLINE uint8 Block(uint8 Light) { return Light & 0x0F; }
+
+    // Brightness the mesher bakes: the stronger of the two channels
+    FORCEINLINE uint8 Level(uint8 Light) { return FMath::Max(Sky(Light), Block(Light)); }
+
+    // Changed cells per chunk, as local-coord bounds (min, max), for remeshing
+    using FChanges = TMap<FChunkKey, TPair<FIntVector, FIntVector>>;
+
+    // Loaded chunk for a key, or null; chunks without a light volume are treated as unavailable
+    using FResolve = TFunctionRef<FVoxelChunkData*(const FChunkKey&)>;
+
+    /** Full flood fill of Data.Light (worker). Light already in the neighbours' borders flows in;
+     *  nothing is written to the neighbours (see StitchBorders). */
+    void ComputeChunk(FVoxelChunkData& Data, const FVoxelChunkNeighbors* Neighbors);
+
+    /** Relight around changed voxels (global voxel coords): removes light that was fed through or
+     *  emitted by the old blocks and refills from what remains, across loaded chunks. */
+    void UpdateAfterEdits(TConstArrayView<FIntVector> Cells, FResolve Resolve, FChanges& OutChanges);
+
+    /** Exchange light across the borders between Key and its four side neighbours: first clears
+     *  border light that lost its source on the other side, then spreads what is left. */
+    void StitchBorders(const FChunkKey& Key, FResolve Resolve, FChanges& OutChanges);
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PackedNormal.h"
+#include "Misc/ScopeLock.h"
+#include "ChunkConfig.h"     // VOXEL_NO_SHRINK
+
+/**
+ * GPU-ready buffers for one chunk mesh section, built on a worker and moved into
+ * UVoxelChunkMeshComponent. Formats match the local vertex factory so the component
+ * fills its vertex/index buffers straight from these arrays (~32 bytes per vertex).
+ */
+struct FVoxelMeshSectionBuffers
+{
+    TArray<FVector3f>     Positions; // chunk-local, in Unreal units
+    TArray<FPackedNormal> TangentX;
+    TArray<FPackedNormal> TangentZ;  // normal; W = binormal sign
+    TArray<FVector2f>     UVs;
+    TArray<FColor>        Colors;
+    TArray<uint32>        Indices;   // uploaded as 16-bit when the vertex count allows
+
+    FBox3f Bounds = FBox3f(ForceInit);
+
+    int32 NumVertices() const { return Positions.Num(); }
+    bool IsEmpty() const { return Indices.Num() == 0; }
+
+    void Reset(int32 ExpectedVertices = 0, int32 ExpectedIndices = 0)
+    {
+        Positions.Reset(ExpectedVertices);
+        TangentX.Reset(ExpectedVertices);
+        TangentZ.Reset(ExpectedVertices);
+        UVs.Reset(ExpectedVertices);
+        Colors.Reset(ExpectedVertices);
+        Indices.Reset(ExpectedIndices);
+        Bounds = FBox3f(ForceInit);
+    }
+};
+
+/**
+ * Thread-safe free lists of section buffers in power-of-two vertex-capacity classes.
+ * Workers acquire buffers sized for the mesh they are about to expand; the game thread
+ * releases them after upload, so steady-state streaming cycles storage without reallocating.
+ */
+class FVoxelMeshBufferPool
+{
+public:
+    explicit FVoxelMeshBufferPool(int32 InMaxPerClass = 8)
+        : MaxPerClass(InMaxPerClass) {}
+
+    // Empty buffers with room for at least NumVertices (quads: 6 indices per 4 vertices).
+    FVoxelMeshSectionBuffers Acquire(int32 NumVertices)
+    {
+        const int32 Class = ClassFor(NumVertices);
+        {
+            FScopeLock Lock(&Mutex);
+            for (int32 c = Class; c < NumClasses; ++c)
+            {
+                if (Free[c].Num() > 0)
+                {
+                    return Free[c].Pop(VOXEL_NO_SHRINK);
+                }
+            }
+        }
+
+        // Fresh buffers get the full class capacity so they fit anything in the class later
+        const int32 Capacity = FMath::Max(NumVertices, 1 << (Class + MinClassLog2));
+        FVoxelMeshSectionBuffers Out;
+        Out.Reset(Capacity, Capacity / 4 * 6);
+        return Out;
+    }
+
+    // Return storage (contents are discarded). Buffers too small to be worth keeping are freed.
+    // Positions/Indices may be older collision storage swapped out by the mesh component, so the
+    // set is classed by its render-only arrays and those two are pooled on their own.
+    void Release(FVoxelMeshSectionBuffers&& Buffers)
+    {
+        ReleaseCollision(MoveTemp(Buffers.Positions), MoveTemp(Buffers.Indices));
+
+        const int32 Capacity = FMath::Min(FMath::Min(Buffers.TangentX.Max(), Buffers.TangentZ.Max()),
+            FMath::Min(Buffers.UVs.Max(), Buffers.Colors.Max()));
+        if (Capacity < (1 << MinClassLog2)) return;
+
+        const int32 Class = ClassOf(Capacity);
+        Buffers.Reset(); // keeps allocations
+
+        FScopeLock Lock(&Mutex);
+        if (Free[Class].Num() < MaxPerClass)
+        {
+            // Refill positions/indices from the smallest pooled pair that fits the class
+            for (int32 c = Class; c < NumClasses && Buffers.Positions.Max() == 0; ++c)
+            {
+                if (FreeCollision[c].Num() > 0)
+                {
+                    FCollisionStorage S = FreeCollision[c].Pop(VOXEL_NO_SHRINK);
+                    Buffers.Positions = MoveTemp(S.Positions);
+                    Buffers.Indices = MoveTemp(S.Indices);
+                }
+            }
+            if (Buffers.Positions.Max() == 0)
+            {
+                Buffers.Positions.Reserve(Capacity);
+                Buffers.Indices.Reserve(Capacity / 4 * 6);
+            }
+            Free[Class].Add(MoveTemp(Buffers));
+        }
+    }
+
+    // Return a position/index pair on its own (e.g. a destroyed component's collision data)
+    void ReleaseCollision(TArray<FVector3f>&& Positions, TArray<uint32>&& Indices)
+    {
+        const int32 Capacity = FMath::Min(Positions.Max(), Indices.Max() / 6 * 4);
+        if (Capacity < (1 << MinClassLog2)) return;
+
+        const int32 Class = ClassOf(Capacity);
+        FCollisionStorage S;
+        S.Positions = MoveTemp(Positions);
+        S.Indices = MoveTemp(Indices);
+        S.Positions.Reset();
+        S.Indices.Reset();
+
+        FScopeLock Lock(&Mutex);
+        if (FreeCollision[Class].Num() < MaxPerClass)
+        {
+            FreeCollision[Class].Add(MoveTemp(S));
+        }
+    }
+
+private:
+    static constexpr int32 MinClassLog2 = 8; // 256 vertices (64 quads)
+    static constexpr int32 NumClasses = 12;  // up to 2^19 vertices
+
+    struct FCollisionStorage
+    {
+        TArray<FVector3f> Positions;
+        TArray<uint32>    Indices;
+    };
+
+    // Smallest class whose capacity holds NumVertices
+    static int32 ClassFor(int32 NumVertices)
+    {
+        const int32 Log2 = (int32)FMath::CeilLogTwo((uint32)FMath::Max(NumVertices, 1));
+        return FMath::Clamp(Log2 - MinClassLog2, 0, NumClasses - 1);
+    }
+
+    // Largest class whose capacity fits in Capacity (>= 1 << MinClassLog2)
+    static int32 ClassOf(int32 Capacity)
+    {
+        return FMath::Min((int32)FMath::FloorLog2((uint32)Capacity) - MinClassLog2, NumClasses - 1);
+    }
+
+    mutable FCriticalSection Mutex;
+    TArray<FVoxelMeshSectionBuffers> Free[NumClasses];
+    TArray<FCollisionStorage> FreeCollision[NumClasses];
+    int32 MaxPerClass;
+};
@@ -3,31 +3,142 @@
 #include "CoreMinimal.h"
 #include "VoxelChunk.h"
 #include "VoxelTypes.h"
-#include "ProceduralMeshComponent.h"
+#include "ChunkConfig.h"
+#include "VoxelMeshBuffers.h"
+#include "VoxelBlockRegistry.h"
+
+// Coarsest LOD: cells of 2^3 = 8 voxels per axis.
+constexpr int32 VOXEL_MAX_LOD = 3;
+static_assert(CHUNK_SIZE_X % (1 << VOXEL_MAX_LOD) == 0 && CHUNK_SIZE_Y % (1 << VOXEL_MAX_LOD) == 0 &&
+    CHUNK_SIZE_Z % (1 << VOXEL_MAX_LOD) == 0, "Chunk dimensions must divide into the coarsest LOD cell");
+static_assert(CHUNK_SECTION_HEIGHT % (1 << VOXEL_MAX_LOD) == 0, "Sections must hold whole LOD cells");
+
+// Mesh output is split per vertical section and render layer: group = Section * Layers + Layer.
+// The group index is also the chunk component's section index.
+constexpr int32 VOXEL_NUM_MESH_GROUPS = CHUNK_NUM_SECTIONS * VOXEL_NUM_RENDER_LAYERS;
+
+FORCEINLINE constexpr int32 VoxelMeshGroup(int32 Section, int32 Layer) { return Section * VOXEL_NUM_RENDER_LAYERS + Layer; }
+
+// Sections whose faces can change when voxel rows MinY..MaxY change (culling and AO reach one voxel up/down)
+FORCEINLINE uint8 VoxelSectionsForRows(int32 MinY, int32 MaxY)
+{
+    const int32 Lo = FMath::Clamp(MinY - 1, 0, CHUNK_SIZE_Y - 1) / CHUNK_SECTION_HEIGHT;
+    const int32 Hi = FMath::Clamp(MaxY + 1, 0, CHUNK_SIZE_Y - 1) / CHUNK_SECTION_HEIGHT;
+    return (uint8)(((1u << (Hi + 1)) - 1) & ~((1u << Lo) - 1));
+}
+
+FORCEINLINE uint8 VoxelSectionsAroundY(int32 Y) { return VoxelSectionsForRows(Y, Y); }
+
+/**
+ * One visible voxel face in compact form (local voxel coords, face, block, atlas tile).
+ * For LOD meshes the coords are in cell units; the LOD is per chunk and passed to expansion.
+ * Normals, tangents, colors and UVs are per-face constants, so they are only materialized
+ * when the face is expanded for upload.
+ */
+struct FVoxelPackedFace
+{
+    uint8 X = 0;
+    uint8 Y = 0;
+    uint8 Z = 0;
+    uint8 Face = 0;    // EVoxelFace
+    uint8 BlockId = 0; // EBlockId
+    uint8 Tile = 0;    // atlas tile index
+    uint8 AO = 0xFF;   // corner occlusion, 2 bits per corner (3 = open, 0 = fully occluded)
+    uint8 Light[2] = { 0xFF, 0xFF }; // smoothed corner light, 4 bits per corner (15 = full)
+};
+static_assert(sizeof(FVoxelPackedFace) == 9, "FVoxelPackedFace should stay tightly packed");
+
+/**
+ * The one-voxel ring around a chunk, for border-correct AO, light and light inflow. Copied out of
+ * the 8 neighbours on the game thread (CopyFrom), so workers never read chunk data that edits
+ * and simulation steps keep writing. Slot = (DZ + 1) * 3 + (DX + 1); slot 4 is the chunk itself
+ * and stays empty. Missing neighbours read as air.
+ *
+ * Each slot holds the neighbour's cells that touch the chunk: a full side (16 columns) or one
+ * corner column, CHUNK_SIZE_Y cells each, indexed by RingIndex.
+ */
+struct FVoxelChunkNeighbors
+{
+    TArray<uint8> Ids[9];   // empty when the neighbour is not loaded
+    TArray<uint8> Light[9]; // empty when the neighbour is not loaded or not lit yet
+
+    static constexpr int32 Slot(int32 DX, int32 DZ) { return (DZ + 1) * 3 + (DX + 1); }
+
+    // Columns along the border a slot covers
+    static constexpr int32 Length(int32 DX, int32 DZ) { return DX != 0 && DZ != 0 ? 1 : (DX != 0 ? CHUNK_SIZE_Z : CHUNK_SIZE_X); }
+
+    // Ring position of the neighbour-local cell (NX, Y, NZ) touching the chunk
+    static FORCEINLINE int32 RingIndex(int32 DX, int32 DZ, int32 NX, int32 Y, int32 NZ)
+    {
+        const int32 T = DX == 0 ? NX : (DZ == 0 ? NZ : 0);
+        return T + Y * Length(DX, DZ);
+    }
+
+    bool Has(int32 DX, int32 DZ) const { return Ids[Slot(DX, DZ)].Num() > 0; }
+
+    // Copy the ring cells (and light, if lit) of the neighbour at (DX, DZ). Game thread.
+    void CopyFrom(int32 DX, int32 DZ, const FVoxelChunkData& Neighbor);
+
+    // Bit per present slot
+    uint16 GetMask() const
+    {
+        uint16 Mask = 0;
+        for (int32 i = 0; i < 9; ++i)
+        {
+            if (Ids[i].Num() > 0) Mask |= (uint16)(1u << i);
+        }
+        return Mask;
+    }
+};
 
 /**
  * Naive mesher that emits visible faces only.
- * - Produces scaled vertex positions (in world units) given BlockSize.
- * - Produces simple UVs suitable for a tiled atlas.
+ * - BuildPackedMesh produces FVoxelPackedFace records (9 bytes per quad) on the worker, with
+ *   classic corner AO and smooth corner light sampled from a one-voxel border padded in from
+ *   the neighbour chunks.
+ * - ExpandPackedMesh turns them into GPU-format vertex buffers (scaled by BlockSize).
+ * - UVs, colors, normals and tangents come from the VoxelBlocks tables (per block and face).
  */
 class FVoxelMesher_Naive
 {
 public:
-    /** Build mesh arrays from the chunk.
+    /** Emit one packed record per visible face of the sections in SectionMask, grouped by mesh
+     *  group (section, then opaque/cutout/translucent; see CountGroups). Culling still reads the
+     *  whole chunk, so section boundaries get no walls. bTwoPass counts faces first and reserves
+     *  OutFaces exactly (one extra culling pass); otherwise OutFaces grows from its capacity. */
+    static void BuildPackedMesh(const FVoxelChunkData& Chunk, TArray<FVoxelPackedFace>& OutFaces, bool bTwoPass = false,
+        const FVoxelChunkNeighbors* Neighbors = nullptr, uint8 SectionMask = CHUNK_ALL_SECTIONS);
+
+    /** Same, from a grid downsampled by 2^Lod per axis (majority solid, topmost block id).
+     *  Neighbours are only used at Lod 0; coarser meshes take AO from their own cells. */
+    static void BuildPackedMeshLod(const FVoxelChunkData& Chunk, int32 Lod, TArray<FVoxelPackedFace>& OutFaces, bool bTwoPass = false,
+        const FVoxelChunkNeighbors* Neighbors = nullptr, uint8 SectionMask = CHUNK_ALL_SECTIONS);
+
+    /** Expand packed faces into GPU-format section buffers (runs on the worker).
      * BlockSize = size of one cube along each axis in Unreal units (e.g. 100)
+     * Light scales the vertex color RGB, AO goes to its alpha (material multiplies it in); quads split along the
+     * brighter diagonal so occlusion gradients stay symmetric.
      */
-    static void BuildMesh(const FVoxelChunkData& Chunk, float BlockSize,
-        TArray<FVector>& OutVertices,
-        TArray<int32>& OutTriangles,
-        TArray<FVector>& OutNormals,
-        TArray<FVector2D>& OutUVs,
-        TArray<FLinearColor>& OutColors,
-        TArray<FProcMeshTangent>& OutTangents);
+    static void ExpandPackedMesh(TConstArrayView<FVoxelPackedFace> Faces, float BlockSize, FVoxelMeshSectionBuffers& Out, int32 Lod = 0);
+
+    /** Faces per mesh group of a BuildPackedMesh result; group G starts at the sum of the counts before it. */
+    static void CountGroups(TConstArrayView<FVoxelPackedFace> Faces, int32 Lod, int32 (&OutCounts)[VOXEL_NUM_MESH_GROUPS]);
+
+    /** Order faces far-to-near from EyeVoxel (chunk-local voxel units, X/Y up/Z) for translucent draw. */
+    static void SortBackToFront(TArrayView<FVoxelPackedFace> Faces, const FVector3f& EyeVoxel, int32 Lod = 0);
+
+    /** Build every mesh group of the chunk (BuildPackedMesh + ExpandPackedMesh). */
+    static void BuildMesh(const FVoxelChunkData& Chunk, float BlockSize, FVoxelMeshSectionBuffers (&Out)[VOXEL_NUM_MESH_GROUPS], int32 Lod = 0);
 
 private:
+    // Face culling + AO over a dense grid padded by Pad cells in X/Z
+    // (index = (X+Pad) + (Z+Pad)*(SX+2*Pad) + Y*(SX+2*Pad)*(SZ+2*Pad)). Padding feeds AO and
+    // translucent culling; other faces on the chunk border are always emitted.
+    // Only cells in SectionMask (CHUNK_SECTION_HEIGHT >> Lod cells per section) emit faces.
+    // LightGrid has the same layout as Grid; null means fully lit.
+    static void EmitPackedFaces(const uint8* Grid, const uint8* LightGrid, int32 SX, int32 SY, int32 SZ, int32 Pad, int32 Lod, uint8 SectionMask,
+        TArray<FVoxelPackedFace>& OutFaces, bool bTwoPass);
+
     // helper: returns true if neighbor at world-local (x+nx,y+ny,z+nz) is empty (air)
     static bool IsAirNeighbor(const FVoxelChunkData& Chunk, int32 X, int32 Y, int32 Z, int32 NX, int32 NY, int32 NZ);
-
-    // Simple atlas mapping: returns bottom-left UV and tile size (uTile,vTile)
-    static void GetAtlasUVForBlock(EBlockId Id, FVector2D& OutUV0, FVector2D& OutTileSize);
 };
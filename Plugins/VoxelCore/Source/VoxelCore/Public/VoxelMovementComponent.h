@@ -0,0 +1,69 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/PawnMovementComponent.h"
+#include "VoxelMovementComponent.generated.h"
+
+class AVoxelWorldManager;
+
+/**
+ * Walking/falling pawn movement that collides with voxel data through AVoxelWorldManager's
+ * sweep queries instead of chunk physics bodies, so it works with bChunkPhysicsCollision off.
+ * The pawn's collision shape is treated as its bounding box; moves resolve one axis at a time
+ * (vertical first) and step up one block when walking into a ledge.
+ *
+ * Box-only on purpose: voxels are axis-aligned cubes, so a box sweep against the grid is exact
+ * and per-axis sliding falls out of it. A capsule's rounded base would need per-voxel shape
+ * tests and would slide off block edges instead of standing on them.
+ */
+UCLASS(ClassGroup = Movement, meta = (BlueprintSpawnableComponent))
+class UVoxelMovementComponent : public UPawnMovementComponent
+{
+    GENERATED_BODY()
+public:
+    UVoxelMovementComponent();
+
+    /** World to collide with; the first one in the level when unset. */
+    UPROPERTY(EditAnywhere, Category = "Voxel Movement")
+    TWeakObjectPtr<AVoxelWorldManager> WorldManager;
+
+    UPROPERTY(EditAnywhere, Category = "Voxel Movement", meta = (ClampMin = "0"))
+    float MaxWalkSpeed = 600.f;
+
+    UPROPERTY(EditAnywhere, Category = "Voxel Movement", meta = (ClampMin = "0"))
+    float Acceleration = 2048.f;
+
+    UPROPERTY(EditAnywhere, Category = "Voxel Movement", meta = (ClampMin = "0"))
+    float BrakingDeceleration = 2048.f;
+
+    /** Fraction of Acceleration/BrakingDeceleration available in the air. */
+    UPROPERTY(EditAnywhere, Category = "Voxel Movement", meta = (ClampMin = "0", ClampMax = "1"))
+    float AirControl = 0.3f;
+
+    UPROPERTY(EditAnywhere, Category = "Voxel Movement", meta = (ClampMin = "0"))
+    float JumpZVelocity = 500.f;
+
+    /** Climb one-block ledges while walking. */
+    UPROPERTY(EditAnywhere, Category = "Voxel Movement")
+    bool bAutoStep = true;
+
+    UFUNCTION(BlueprintCallable, Category = "Voxel Movement")
+    void Jump() { bWantsJump = true; }
+
+    UFUNCTION(BlueprintPure, Category = "Voxel Movement")
+    bool IsOnGround() const { return bOnGround; }
+
+    virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+    virtual bool IsMovingOnGround() const override { return bOnGround; }
+    virtual bool IsFalling() const override { return !bOnGround; }
+
+    /** Auto-step test for a box blocked while moving by Move: clear straight up by StepHeight
+     *  (head clearance), then clear across from there. */
+    static bool CanStepUp(const AVoxelWorldManager& World, const FBox& Box, const FVector& Move, float StepHeight);
+
+private:
+    AVoxelWorldManager* ResolveWorldManager();
+
+    bool bOnGround = false;
+    bool bWantsJump = false;
+};
@@ -0,0 +1,30 @@
+#pragma once
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "VoxelPregenCommandlet.generated.h"
+
+/**
+ * Headless world baking. Generates every chunk of a world size preset on all cores and writes
+ * them as full (palettized) snapshots, so the runtime loads them without generating and later
+ * generator changes leave the baked area as it was. The column summary for the far field is
+ * written with each save.
+ *
+ * -Mesh also meshes every baked chunk (Lod 0, without neighbours) and logs triangle counts and
+ * meshing throughput next to the generation rate. Meshes are not written: the runtime builds
+ * its own once neighbours and light are known, so this only sizes the meshing cost up front.
+ *
+ * UnrealEditor-Cmd <Project> -run=VoxelPregen -nullrhi [-Size=Small|Medium|Large] [-Radius=N]
+ *     [-Seed=N] [-HeightScale=F] [-HeightOffset=F] [-NoiseFrequency=F] [-Mesh] [-Overwrite]
+ *
+ * Chunks that already have a save file are skipped unless -Overwrite is given, so player
+ * edits are never clobbered by default.
+ */
+UCLASS()
+class UVoxelPregenCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+public:
+    UVoxelPregenCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -1,13 +1,53 @@
 #pragma once
 #include "CoreMinimal.h"
+#include "ChunkConfig.h"
 
 struct FVoxelChunkData;
+struct FChunkKey;
+struct FVoxelGeneratorConfig;
+
+// Top solid block per column of a saved chunk (index = X + Z*CHUNK_SIZE_X). Written next to
+// each save so far-field terrain can show edits without loading the chunk itself.
+struct FVoxelColumnSummary
+{
+	uint8 TopY[CHUNK_SIZE_X * CHUNK_SIZE_Z];
+	uint8 TopId[CHUNK_SIZE_X * CHUNK_SIZE_Z]; // EBlockId; Air for empty columns
+};
 
 namespace VoxelSaveSystem
 {
-	// Apply saved edits (if any) into Data (keyed by Data.Key and Seed).
-	bool LoadDelta(int32 Seed, FVoxelChunkData& Data);
+	// Saved/Voxel/Seed_N, created on demand. Chunk files and the edit journal live under it.
+	FString GetWorldDir(int32 Seed);
+
+	// Apply saved edits (if any) into Data (keyed by Data.Key and Config.Seed).
+	// Data must already hold the base generated with Config. If the file was saved against a
+	// different generator config and bMaterialize is set, the old base is regenerated from the
+	// config stored in the header and the edits are flattened into a full snapshot, marked
+	// bUnsaved so the chunk's next save (not the load) writes it.
+	bool LoadDelta(const FVoxelGeneratorConfig& Config, FVoxelChunkData& Data, bool bMaterialize = true);
+
+	// Full load path for a fresh chunk: reads the file once and only calls GenerateBase when the
+	// save is a delta (or missing). Chunks saved as full snapshots skip generation entirely.
+	// Returns true if saved data was applied.
+	bool LoadChunk(const FVoxelGeneratorConfig& Config, FVoxelChunkData& Data,
+		TFunctionRef<void(FVoxelChunkData&)> GenerateBase, bool bMaterialize = true);
+
+	// Queue edits (flat index, id) for a chunk that is not loaded by appending them to its .vce
+	// sidecar as runs of consecutive indices with one id (7 bytes each); nothing is generated or
+	// meshed. LoadChunk/LoadDelta merge them (in order, after the saved payload) and the next
+	// SaveDelta of that chunk folds them in and drops the sidecar. Blocking file IO: call it
+	// off the game thread.
+	void AppendEdits(int32 Seed, const FChunkKey& Key, TConstArrayView<TPair<int32, uint8>> Edits);
+
+	// True if the chunk has a save (.vcd, delta or snapshot). A .vce of pending edits alone does
+	// not count: those still merge over whatever base the chunk is given, baked or generated.
+	bool HasChunk(int32 Seed, const FChunkKey& Key);
+
+	// Persist the chunk as deltas against Config's base or as full palette-compressed contents,
+	// whichever is smaller. Chunks with bSnapshotBase always save full contents. Chunks with no
+	// deltas are skipped unless bUnsaved, which writes an empty delta save.
+	void SaveDelta(const FVoxelGeneratorConfig& Config, const FVoxelChunkData& Data);
 
-	// Persist edited cells from Data.ModifiedBlocks for this chunk.
-	void SaveDelta(int32 Seed, const FVoxelChunkData& Data);
+	// Column summary written by SaveDelta. False if the chunk was never saved.
+	bool LoadColumnSummary(int32 Seed, const FChunkKey& Key, FVoxelColumnSummary& Out);
 }
@@ -12,6 +12,20 @@ enum class EBlockId : uint8
 	Stone = 3,
 	Sand = 4,
 	Water = 5,
+	Log = 6,
+	Leaves = 7,
+	CoalOre = 8,
+	Glass = 9,
+	Lamp = 10,
+	// Flowing water, one id per level (1 = thinnest, 7 = next to a source or falling). Sources are Water.
+	WaterFlow1 = 11,
+	WaterFlow2,
+	WaterFlow3,
+	WaterFlow4,
+	WaterFlow5,
+	WaterFlow6,
+	WaterFlow7,
+	Gravel = 18,
 	// Add more block types here
 	Max
 };
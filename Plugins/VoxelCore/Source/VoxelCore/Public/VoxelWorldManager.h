@@ -2,12 +2,20 @@
 
 #include "CoreMinimal.h"
 #include "GameFramework/Actor.h"
-#include "ProceduralMeshComponent.h"     // FProcMeshTangent
+#include "Async/Future.h"
 #include "ChunkHelpers.h"                // FChunkKey
 #include "VoxelChunk.h"                  // FVoxelChunkData
+#include "VoxelMeshBuffers.h"            // FVoxelMeshSectionBuffers
+#include "VoxelMesher.h"                 // VOXEL_NUM_MESH_GROUPS, FVoxelChunkNeighbors
+#include "VoxelEditJournal.h"            // FVoxelEditRecord, FVoxelEditTransaction
+#include "VoxelLight.h"                  // VoxelLight::FChanges
+#include "VoxelFluid.h"                  // VoxelFluid::FStep
+#include "VoxelBlockTicks.h"             // FVoxelTickQueue
 #include "VoxelWorldManager.generated.h"
 
 class AVoxelChunkActor;
+class FVoxelFeatureCache;
+struct FVoxelGeneratorConfig;
 
 UENUM(BlueprintType)
 enum class EVoxelWorldSize : uint8
@@ -17,20 +25,81 @@ enum class EVoxelWorldSize : uint8
     Large  UMETA(DisplayName = "Large")
 };
 
-/** Off-thread result: mesh buffers + data. */
+/** Off-thread result: GPU-format section buffers + data, moved straight into the chunk component. */
 struct FChunkMeshResult
 {
     FChunkKey Key;
     float     BlockSize = 100.f;
 
     TSharedPtr<FVoxelChunkData> Data;
+    int32 Lod = 0;
+    uint16 NeighborMask = 0; // FVoxelChunkNeighbors slots the AO was sampled from
+    uint8 SectionMask = CHUNK_ALL_SECTIONS; // vertical sections meshed; only their groups are uploaded
+    uint32 SectionSerials[CHUNK_NUM_SECTIONS] = {}; // record serials when kicked; mismatch = stale
+    bool bLightComputed = false; // Data was lit on the worker; its borders still need stitching
+
+    // Translucent faces of each meshed section, sorted back to front for SortEye (world UU). The
+    // record keeps them so a camera move re-sorts and re-expands just these, without remeshing.
+    TArray<FVoxelPackedFace> TranslucentFaces[CHUNK_NUM_SECTIONS];
+    FVector SortEye = FVector::ZeroVector;
+    bool bTranslucentOnly = false; // re-sort job: only SectionMask's translucent groups are set
+
+    // One per mesh group (section x render layer), ~32 bytes per vertex in render format;
+    // no further conversion on the game thread
+    FVoxelMeshSectionBuffers Sections[VOXEL_NUM_MESH_GROUPS];
+};
+
+/** Off-thread far-field heightmap tile. */
+struct FFarTileResult
+{
+    FChunkKey Tile;
+    TArray<FVoxelMeshSectionBuffers> Sections; // one per chunk of the tile
+};
+
+/** RaycastVoxels result. Coordinates are voxel space (X, Y up, Z). */
+struct FVoxelRayHit
+{
+    FChunkKey  Key;
+    int32      X = 0, Y = 0, Z = 0;                   // hit voxel, local to Key
+    FIntVector Global = FIntVector::ZeroValue;        // hit voxel, world voxel coords
+    FIntVector Normal = FIntVector::ZeroValue;        // face entered through; zero if the ray starts inside
+    uint8      BlockId = 0;
+    double     Distance = 0.0;                        // UU from the ray start to ImpactPoint
+    FVector    ImpactPoint = FVector::ZeroVector;
+
+    // Neighbour cell on the normal side (where a placed block goes); false if it is outside the world
+    bool GetAdjacent(FChunkKey& OutKey, int32& OutX, int32& OutY, int32& OutZ) const
+    {
+        if (Normal == FIntVector::ZeroValue) return false;
+        const FIntVector G = Global + Normal;
+        if (G.Y < 0 || G.Y >= CHUNK_SIZE_Y) return false;
+        OutKey = GlobalToChunkLocal(G.X, G.Z, OutX, OutZ);
+        OutY = G.Y;
+        return true;
+    }
+};
+
+/** SweepVoxelBox result. */
+struct FVoxelSweepHit
+{
+    bool       bStartPenetrating = false;             // the box already overlapped solid voxels
+    float      Time = 1.f;                            // fraction of Delta travelled before contact
+    FVector    Location = FVector::ZeroVector;        // box center at contact
+    FVector    Normal = FVector::ZeroVector;          // world-space face normal of the blocking voxel
+    FIntVector Voxel = FIntVector::ZeroValue;         // blocking voxel, world voxel coords (X, Y up, Z)
+};
 
-    TArray<FVector>          V;
-    TArray<int32>            I;
-    TArray<FVector>          N;
-    TArray<FVector2D>        UV;
-    TArray<FLinearColor>     C;
-    TArray<FProcMeshTangent> T;
+/** Voxel write submitted through AVoxelWorldManager::SubmitEdit(s). */
+struct FVoxelEditCommand
+{
+    FIntVector Voxel = FIntVector::ZeroValue; // world voxel coords (X, Y up, Z)
+    uint8 BlockId = 0;
+};
+
+struct FFarTileRecord
+{
+    TWeakObjectPtr<AVoxelChunkActor> Actor;
+    TBitArray<> HiddenChunks; // per section; set once the chunk under it has a real mesh
 };
 
 USTRUCT()
@@ -40,7 +109,18 @@ struct FChunkRecord
 
     TSharedPtr<FVoxelChunkData>      Data;
     TWeakObjectPtr<AVoxelChunkActor> Actor;
-    bool bDirty = false;
+    uint8 DirtySections = 0; // edited while a job was in flight; remeshed when it lands
+    uint32 SectionSerials[CHUNK_NUM_SECTIONS] = {}; // bumped by game-thread remeshes
+    int32 Lod = 0; // LOD the actor's mesh was built at
+    uint16 NeighborMask = 0; // neighbours present when it was built
+
+    // Translucent sort state of the current mesh (see FChunkMeshResult)
+    TArray<FVoxelPackedFace> TranslucentFaces[CHUNK_NUM_SECTIONS];
+    bool bSortedTranslucent = false; // some section has more than one face to order
+    FIntVector TranslucentMin = FIntVector::ZeroValue; // face box, chunk-local voxels
+    FIntVector TranslucentMax = FIntVector::ZeroValue;
+    FVector SortEye = FVector::ZeroVector; // eye the oldest kept order was sorted for
+    int32 SortSide = 0; // side of the box SortEye was on (see ClassifySortSide)
 };
 
 UCLASS(Blueprintable)
@@ -54,6 +134,14 @@ public:
     UPROPERTY(EditAnywhere, Category = "Voxel|Streaming")
     UMaterialInterface* ChunkMaterial = nullptr;
 
+    /** Masked material for cutout blocks (leaves, glass). Falls back to ChunkMaterial. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|Streaming")
+    UMaterialInterface* CutoutMaterial = nullptr;
+
+    /** Translucent material for water; opacity comes from the material. Falls back to ChunkMaterial. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|Streaming")
+    UMaterialInterface* TranslucentMaterial = nullptr;
+
     /** Size of a voxel in UU. */
     UPROPERTY(EditAnywhere, Category = "Voxel|Streaming")
     float BlockSize = 100.f;
@@ -70,10 +158,132 @@ public:
     UPROPERTY(EditAnywhere, Category = "Voxel|Streaming")
     int32 WorldSeed = 1337;
 
+    /** Terrain tuning. Part of the generator fingerprint stored in saves. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|Generation")
+    float TerrainHeightScale = static_cast<float>(CHUNK_SIZE_Y) * 0.6f;
+
+    UPROPERTY(EditAnywhere, Category = "Voxel|Generation")
+    float TerrainHeightOffset = static_cast<float>(CHUNK_SIZE_Y) * 0.2f;
+
+    UPROPERTY(EditAnywhere, Category = "Voxel|Generation")
+    float TerrainNoiseFrequency = 0.05f;
+
+    /** When terrain tuning changed since a chunk was saved, rebuild its old contents and
+     *  store them as a full snapshot instead of replaying deltas onto the new terrain. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|Generation")
+    bool bMaterializeEditsOnConfigChange = true;
+
     /** How often to update streaming (s). */
     UPROPERTY(EditAnywhere, Category = "Voxel|Streaming", meta = (ClampMin = "0.02", ClampMax = "2.0"))
     float UpdateIntervalSeconds = 0.15f;
 
+    /** Use downsampled meshes for distant chunks. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|LOD")
+    bool bEnableLod = true;
+
+    /** Chunks within this Chebyshev distance mesh at full resolution. LOD n covers up to
+     *  2^n times this distance; cells are 2^n voxels wide. Must stay below RenderRadiusChunks
+     *  for any LOD to engage. Seams between LODs are not stitched: each chunk's closed border
+     *  walls are the only crack cover, so coarse cells can still show a step at the seam. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|LOD", meta = (ClampMin = "1", ClampMax = "32", EditCondition = "bEnableLod"))
+    int32 LodFullDetailRadiusChunks = 3;
+
+    /** Coarsest LOD used (3 = 8x8x8 voxel cells). */
+    UPROPERTY(EditAnywhere, Category = "Voxel|LOD", meta = (ClampMin = "0", ClampMax = "3", EditCondition = "bEnableLod"))
+    int32 MaxLod = 3;
+
+    /** Draw cheap heightmap tiles past the voxel radius. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|FarField")
+    bool bEnableFarField = true;
+
+    /** Square radius (in chunks) covered by far-field tiles. Should exceed RenderRadiusChunks. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|FarField", meta = (ClampMin = "1", ClampMax = "256", EditCondition = "bEnableFarField"))
+    int32 FarFieldRadiusChunks = 24;
+
+    /** Chunks per far tile side. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|FarField", meta = (ClampMin = "1", ClampMax = "16", EditCondition = "bEnableFarField"))
+    int32 FarTileChunks = 4;
+
+    /** Heightmap sample spacing in voxels (rounded down to divide the chunk width). */
+    UPROPERTY(EditAnywhere, Category = "Voxel|FarField", meta = (ClampMin = "1", ClampMax = "16", EditCondition = "bEnableFarField"))
+    int32 FarFieldStepVoxels = 4;
+
+    /** How far tiles sit below the voxel surface (UU), so loaded chunks cover them. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|FarField", meta = (EditCondition = "bEnableFarField"))
+    float FarFieldDropUU = 50.f;
+
+    /** Max far tiles being built at once. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|FarField", meta = (ClampMin = "1", ClampMax = "16", EditCondition = "bEnableFarField"))
+    int32 MaxConcurrentFarTileTasks = 2;
+
+    /** Count visible faces before emitting so mesher output is reserved exactly (one extra
+     *  culling pass). Pooled buffers already avoid most regrowth, so this is off by default. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|Streaming")
+    bool bTwoPassMeshing = false;
+
+    /** Remesh the sections touched by an edit on the game thread, so the change shows the same frame. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|Editing")
+    bool bSyncEditRemesh = true;
+
+    /** Game-thread remesh time per frame (ms); edits past it fall back to background jobs. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|Editing", meta = (ClampMin = "0.1", ClampMax = "16.0", EditCondition = "bSyncEditRemesh"))
+    float SyncRemeshBudgetMs = 2.0f;
+
+    /** Log every edit to an append-only journal so edits made since the last chunk save survive a crash. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|Editing")
+    bool bEnableEditJournal = true;
+
+    /** Journaled voxel writes after which the chunks they touched are saved and the journal restarts
+     *  empty (0 = only at EndPlay). Fluid and falling-block writes count too. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|Editing", meta = (ClampMin = "0", EditCondition = "bEnableEditJournal"))
+    int32 JournalCheckpointRecords = 262144;
+
+    /** Edit calls kept for UndoEdit. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|Editing", meta = (ClampMin = "0", ClampMax = "1024"))
+    int32 MaxUndoSteps = 64;
+
+    /** Cook Chaos triangle-mesh collision for full-detail chunks. Turn off when everything that
+     *  touches terrain moves with the voxel queries (UVoxelMovementComponent), saving cook time and physics memory. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|Collision")
+    bool bChunkPhysicsCollision = true;
+
+    /** Let water flow. Only cells next to a change are simulated; still water costs nothing. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|Fluids")
+    bool bSimulateFluids = true;
+
+    /** Fluid steps per second (fixed; a slow frame does not run extra steps). */
+    UPROPERTY(EditAnywhere, Category = "Voxel|Fluids", meta = (ClampMin = "0.5", ClampMax = "60", EditCondition = "bSimulateFluids"))
+    float FluidTickRate = 8.f;
+
+    /** Active cells per step; the rest wait for the next one. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|Fluids", meta = (ClampMin = "64", ClampMax = "262144", EditCondition = "bSimulateFluids"))
+    int32 MaxFluidCellsPerStep = 16384;
+
+    /** Seconds between remeshes of sections changed by flowing water; steps in between share one rebuild. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|Fluids", meta = (ClampMin = "0", ClampMax = "2", EditCondition = "bSimulateFluids"))
+    float FluidRemeshInterval = 0.25f;
+
+    /** Run scheduled and random block ticks (grass spreading and the like). */
+    UPROPERTY(EditAnywhere, Category = "Voxel|BlockTicks")
+    bool bEnableBlockTicks = true;
+
+    /** Block ticks per second (fixed; at most one per frame). */
+    UPROPERTY(EditAnywhere, Category = "Voxel|BlockTicks", meta = (ClampMin = "1", ClampMax = "60", EditCondition = "bEnableBlockTicks"))
+    float BlockTickRate = 20.f;
+
+    /** Random voxels sampled per block tick in each section holding random-ticking blocks. */
+    UPROPERTY(EditAnywhere, Category = "Voxel|BlockTicks", meta = (ClampMin = "0", ClampMax = "64", EditCondition = "bEnableBlockTicks"))
+    int32 RandomTicksPerSection = 3;
+
+    /** Scheduled ticks run per block tick; later ones wait (they only ever run late, never early). */
+    UPROPERTY(EditAnywhere, Category = "Voxel|BlockTicks", meta = (ClampMin = "16", ClampMax = "65536", EditCondition = "bEnableBlockTicks"))
+    int32 MaxScheduledTicksPerStep = 4096;
+
+    /** Random voxel samples per block tick across all chunks; chunks past it get theirs on a later
+     *  step (the step that starts a scan always serves its first chunk). */
+    UPROPERTY(EditAnywhere, Category = "Voxel|BlockTicks", meta = (ClampMin = "16", ClampMax = "65536", EditCondition = "bEnableBlockTicks"))
+    int32 MaxRandomTicksPerStep = 2048;
+
     /** Max background jobs. */
     UPROPERTY(EditAnywhere, Category = "Voxel|Streaming", meta = (ClampMin = "1", ClampMax = "64"))
     int32 MaxConcurrentBackgroundTasks = 8;
@@ -82,6 +292,12 @@ public:
     UPROPERTY(EditAnywhere, Category = "Voxel|Streaming")
     TWeakObjectPtr<AActor> TrackedActor;
 
+    // Soft world clamp (in chunks from origin) for a world size preset
+    static int32 GetWorldRadiusForSize(EVoxelWorldSize Size);
+
+    // Seed + terrain tuning as one config (fingerprint source for saves)
+    FVoxelGeneratorConfig GetGeneratorConfig() const;
+
     // Public wrapper to the existing private WorldToVoxel used by streaming
     bool WorldToVoxel_ForEdit(const FVector& World,
         FChunkKey& OutKey, int32& OutX, int32& OutY, int32& OutZ) const;
@@ -89,13 +305,64 @@ public:
     bool WorldToVoxel_Centered(const FVector& World,
         FChunkKey& OutKey, int32& OutX, int32& OutY, int32& OutZ) const;
 
+    /** Amanatides-Woo DDA through loaded chunk data to the first solid voxel within MaxDistance (UU).
+     *  No physics: works before collision has cooked. Unloaded chunks and non-solid blocks are passed through. */
+    bool RaycastVoxels(const FVector& Start, const FVector& Direction, float MaxDistance, FVoxelRayHit& OutHit) const;
+
+
+    // --- Voxel collision queries (world space, UU; no physics bodies needed) ---
+    // Solid = VoxelBlocks bSolid. Chunks that are not loaded block, and so does everything below
+    // the world floor, so nothing falls out of the streamed area.
+
+    /** True if Box overlaps a solid voxel. Touching faces do not count. */
+    bool OverlapVoxelBox(const FBox& Box) const;
 
-    // Mutate a single cell in a loaded chunk and trigger rebuild
+    /** Moves Box along Delta and stops at the first solid voxel it would enter. */
+    bool SweepVoxelBox(const FBox& Box, const FVector& Delta, FVoxelSweepHit& OutHit) const;
+
+    /** Upright capsule (UE convention: HalfHeight includes Radius) against the voxel grid. */
+    bool OverlapVoxelCapsule(const FVector& Center, float Radius, float HalfHeight) const;
+
+    // Mutate a single cell and trigger a rebuild. Edits to chunks that are not loaded go to the
+    // save store and are merged when the chunk next loads.
     bool RemoveBlock_Local(const FChunkKey& Key, int32 X, int32 Y, int32 Z);
 
     // Sets a voxel to BlockId and schedules a rebuild for that chunk.
     bool PlaceBlock_Local(const FChunkKey& Key, int32 X, int32 Y, int32 Z, uint8 BlockId);
 
+    // --- Shape edits ---
+    // Coordinates are global voxel coords (FVoxelRayHit::Global); BlockId 0 carves. Each call writes
+    // every loaded chunk it covers in one pass, then remeshes each touched chunk once (only the
+    // sections it changed). Covered voxels of unloaded chunks are appended to the save store.
+    // Returns the number of voxels changed (unloaded voxels count as written).
+
+    /** Inclusive box Min..Max. */
+    int32 FillBox(const FIntVector& Min, const FIntVector& Max, uint8 BlockId);
+
+    /** Voxels whose center lies within Radius of Center. */
+    int32 FillSphere(const FIntVector& Center, float Radius, uint8 BlockId);
+
+    /** Upright cylinder: Height rows up from Base, Radius around it in X/Z. */
+    int32 FillCylinder(const FIntVector& Base, float Radius, int32 Height, uint8 BlockId);
+
+    /** Brush: Mask(X, Y, Z) relative to Origin, over Size voxels per axis. */
+    int32 FillMask(const FIntVector& Origin, const FIntVector& Size, TFunctionRef<bool(int32, int32, int32)> Mask, uint8 BlockId);
+
+    // Thread-safe edit submission for gameplay/simulation tasks. Commands are applied at the
+    // start of the next Tick, grouped per chunk (one remesh each). Not added to the undo history;
+    // edits to unloaded chunks go to the save store.
+    void SubmitEdit(const FIntVector& Voxel, uint8 BlockId);
+    void SubmitEdits(TArray<FVoxelEditCommand>&& Edits);
+
+    // Have the block at Voxel (world voxel coords) ticked after DelayTicks block ticks (game thread).
+    // Only for loaded chunks; pending ticks are dropped when their chunk unloads.
+    void ScheduleBlockTick(const FIntVector& Voxel, int32 DelayTicks = 1);
+
+    // Reverts / reapplies the last edit call (block, box, sphere...). Fails while any chunk it
+    // touched is unloaded. Voxels changed since by non-history writes are left alone.
+    bool UndoEdit();
+    bool RedoEdit();
+
 
 protected:
     virtual void BeginPlay() override;
@@ -103,6 +370,9 @@ protected:
     virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 private:
+    // Automation tests (Private/Tests) seed Loaded directly and call the recovery path
+    friend struct FVoxelWorldManagerTestAccess;
+
     // Loaded chunk records
     TMap<FChunkKey, FChunkRecord> Loaded;
 
@@ -110,11 +380,83 @@ private:
     TSet<FChunkKey> Pending;
     TQueue<TSharedPtr<FChunkMeshResult>, EQueueMode::Mpsc> Completed;
 
+    // Far-field tiles (keyed by tile coords)
+    TMap<FChunkKey, FFarTileRecord> FarTiles;
+    TSet<FChunkKey> FarPending;
+    TSet<FChunkKey> FarStale;   // built before a chunk under them was saved; rebuild
+    TQueue<TSharedPtr<FFarTileResult>, EQueueMode::Mpsc> FarCompleted;
+
+    // Section buffers cycled between workers and uploads
+    TSharedPtr<FVoxelMeshBufferPool> MeshPool;
+
+    // Finished results kept for reuse (game thread only)
+    TArray<TSharedPtr<FChunkMeshResult>> FreeResults;
+
+    // Per-region tree/ore/boulder plans, shared by all generation jobs
+    TSharedPtr<FVoxelFeatureCache> FeatureCache;
+
     float TimeAcc = 0.f;
 
+    // Crash journal and undo history (game thread). OpenEdit collects the current call's writes.
+    TUniquePtr<FVoxelEditJournal> Journal;
+    TSet<FChunkKey> JournaledChunks; // chunks with journal records since the last checkpoint
+    int32 JournalRecords = 0;
+    uint32 NextTransactionId = 1;
+    TArray<FVoxelEditRecord> OpenEdit;
+    TArray<FVoxelEditTransaction> UndoStack;
+    TArray<FVoxelEditTransaction> RedoStack;
+
+    // SubmitEdit(s) batches from any thread, drained by ApplyQueuedEdits
+    TQueue<TArray<FVoxelEditCommand>, EQueueMode::Mpsc> EditCommands;
+
+    // Edits (flat index, id) for chunks whose first load was in flight; applied when it lands
+    TMap<FChunkKey, TArray<TPair<int32, uint8>>> DeferredEdits;
+
+    // Edits for unloaded chunks being appended to their .vce sidecars on a worker (one write per
+    // chunk at a time), and edits queued behind them. A chunk does not load until both are clear.
+    TMap<FChunkKey, TFuture<void>> SidecarWrites;
+    TMap<FChunkKey, TArray<TPair<int32, uint8>>> SidecarQueued;
+
+    // Written voxels (global coords) whose light blocking or emission changed; relit on flush
+    TArray<FIntVector> LightDirty;
+
+    // Fluid simulation (game thread side). Touched = written cells that may wake water;
+    // Active = cells for the next step; Parked = active cells of unloaded chunks, woken on load.
+    TArray<FIntVector> FluidTouched;
+    TSet<FIntVector> FluidActive;
+    TMap<FChunkKey, TArray<FIntVector>> FluidParked;
+    TQueue<TSharedPtr<VoxelFluid::FStep>, EQueueMode::Spsc> FluidCompleted;
+    bool bFluidStepInFlight = false;
+    float FluidAcc = 0.f;
+    float FluidRemeshAcc = 0.f;
+    TMap<FChunkKey, uint8> FluidRemesh;
+
+    // Block ticks: per-chunk min-heaps on due tick, and the count they are measured against
+    TMap<FChunkKey, FVoxelTickQueue> ScheduledTicks;
+    uint64 BlockTickCount = 0;
+    int32 BlockTickCursor = 0;   // position in Loaded where the next step starts spending its tick budgets
+    float BlockTickAcc = 0.f;
+    FRandomStream BlockTickRandom;
+
+    // Falling blocks: columns (world voxel X, Z) where one may have lost its support -> lowest row to check
+    TMap<FIntPoint, int32> FallDirty;
+
+    // Game-thread remesh time spent since the start of this frame's Tick
+    double SyncRemeshSecondsThisFrame = 0.0;
+
+    // Running average of one section's game-thread remesh + upload (ms), for budgeting ahead
+    double SyncRemeshMsPerSection = 0.25;
+
+    // Player chunk from the last streaming update; drives per-chunk LOD
+    FIntPoint LodCenter = FIntPoint::ZeroValue;
+
+    // Tracked actor position from the last streaming update; translucent faces sort against it
+    FVector SortEye = FVector::ZeroVector;
+
     // --- Streaming helpers ---
     int32 GetWorldRadiusLimit() const;
     bool  IsWithinWorldLimit(const FChunkKey& Key) const;
+    int32 GetDesiredLod(const FChunkKey& Key) const;
 
     FIntPoint WorldToChunkXZ(const FVector& World) const;
 
@@ -124,8 +466,58 @@ private:
     void RecomputeDesiredSet(const FIntPoint& Center, TSet<FChunkKey>& OutDesired) const;
     void BuildDesiredOrdered(const FIntPoint& Center, TArray<FChunkKey>& OutOrdered) const;
 
-    void KickBuild(const FChunkKey& Key, TSharedPtr<FVoxelChunkData> Existing);
+    void KickBuild(const FChunkKey& Key, TSharedPtr<FVoxelChunkData> Existing, uint8 SectionMask = CHUNK_ALL_SECTIONS);
+    void QueueRemesh(const FChunkKey& Key, uint8 SectionMask);
+    void RemeshForEdit(const FChunkKey& Key, uint8 SectionMask);
+    bool TryRemeshNow(const FChunkKey& Key, uint8 SectionMask);
+    bool NeedsTranslucentResort(const FChunkKey& Key, const FChunkRecord& Rec) const;
+    void KickTranslucentSort(const FChunkKey& Key, const FChunkRecord& Rec);
+    static void SortTranslucent(FChunkMeshResult& R, const FVector& Eye, FVoxelMeshBufferPool& Pool);
+    void UpdateTranslucentSortState(const FChunkKey& Key, FChunkRecord& Rec) const;
+    static void MeshSections(const FVoxelChunkData& Data, int32 Lod, const FVoxelChunkNeighbors* Neighbors,
+        uint8 SectionMask, const FVector& Eye, bool bTwoPass, FVoxelMeshBufferPool& Pool, FChunkMeshResult& R);
+    void GatherNeighbors(const FChunkKey& Key, FVoxelChunkNeighbors& Out) const;
+    uint16 GetNeighborMask(const FChunkKey& Key) const; // slots GatherNeighbors would fill
+    void AddEditRemesh(TMap<FChunkKey, uint8>& Remesh, const FChunkKey& Key, const FIntVector& Lo, const FIntVector& Hi) const;
+    void FlushEditRemesh(TMap<FChunkKey, uint8>& Remesh);
+    void RelightPending(TMap<FChunkKey, uint8>& Remesh);
+    void SettleFallingBlocks(TMap<FChunkKey, uint8>& Remesh);
+    void AddLightRemesh(TMap<FChunkKey, uint8>& Remesh, const VoxelLight::FChanges& Changes) const;
+    FVoxelChunkData* FindLoadedData(const FChunkKey& Key);
+    int32 EditVolume(const FIntVector& Min, const FIntVector& Max, TFunctionRef<bool(int32, int32, int32)> Inside, uint8 BlockId);
+    // --- Edit history ---
+    bool WriteVoxel(const FChunkKey& Key, FVoxelChunkData& Data, int32 Index, uint8 NewId);
+    void CommitEdit(bool bUndoable = true);
+    void ApplyQueuedEdits();
+    void WriteEditsPerChunk(TMap<FChunkKey, TArray<TPair<int32, uint8>>>& PerChunk, TMap<FChunkKey, uint8>& Remesh);
+    void StoreUnloadedEdits(const FChunkKey& Key, TArray<TPair<int32, uint8>>&& Edits);
+    void ApplyDeferredEdits(const FChunkKey& Key);
+    void PumpSidecarWrites();
+    bool ApplyTransaction(const FVoxelEditTransaction& T, bool bUndo);
+    void RecoverJournal();
+    void AppendJournal(TConstArrayView<FVoxelEditRecord> Records, uint32 Transaction);
+    void CheckpointJournal();
+
+    // --- Fluids ---
+    void TickFluids(float DeltaSeconds);
+    void WakeFluidCells();
+    void KickFluidStep();
+    void ApplyFluidStep(VoxelFluid::FStep& Step);
+
+    // --- Block ticks ---
+    void TickBlocks(float DeltaSeconds);
+    void RunBlockTickStep();
+
     void SpawnOrUpdateChunkFromResult(const TSharedPtr<FChunkMeshResult>& Res);
+    TSharedPtr<FChunkMeshResult> AcquireResult();
+    void RecycleResult(const TSharedPtr<FChunkMeshResult>& Res);
+
+    // --- Far field ---
+    void UpdateFarField(const FIntPoint& Center);
+    void KickFarTile(const FChunkKey& Tile);
+    void SpawnFarTileFromResult(const TSharedPtr<FFarTileResult>& Res);
+    void RefreshFarTileVisibility(const FChunkKey& Tile, FFarTileRecord& Rec);
+    void InvalidateFarTile(const FChunkKey& Chunk);
     void UnloadNoLongerNeeded(const TSet<FChunkKey>& Desired);
 
     UWorld* GetWorldChecked() const { check(GetWorld()); return GetWorld(); }
@@ -15,9 +15,8 @@ public class VoxelCore : ModuleRules
 
         PublicDependencyModuleNames.AddRange(new string[]{"Core", "CoreUObject", "Engine", "InputCore"});
 
-        PrivateDependencyModuleNames.AddRange(new string[] { });
-
-        PublicDependencyModuleNames.AddRange(new string[] { "Core", "CoreUObject", "Engine", "InputCore", "ProceduralMeshComponent" });
+        // Chunk mesh component fills vertex/index buffers directly
+        PrivateDependencyModuleNames.AddRange(new string[] { "RenderCore", "RHI" });
 
         // FastNoiseLite is header-only; no additional linking required.
     }